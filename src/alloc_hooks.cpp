@@ -0,0 +1,39 @@
+// Replacement global allocation functions that count every allocation of the calling thread
+// in `common::threadAllocations()`. Link this file into a program to get allocation numbers
+// from `common::PhaseTimer`; the cost is two thread-local increments per `new`, which is why
+// vhdl_formatter only links it with VHDL_FMT_COUNT_ALLOCATIONS.
+
+#include "common/stats.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+[[maybe_unused]] const bool ALLOCATIONS_COUNTED = (common::allocationsCounted() = true);
+
+} // namespace
+
+auto operator new(const std::size_t size) -> void *
+{
+    auto &counters = common::threadAllocations();
+    ++counters.count;
+    counters.bytes += size;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+}
@@ -1,8 +1,10 @@
 #ifndef AST_NODE_HPP
 #define AST_NODE_HPP
 
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -32,11 +34,85 @@ struct NodeTrivia
     std::optional<Comment> inline_comment;
 };
 
+/// @brief Trivia slot of a node, allocated only when the node actually has trivia.
+///
+/// Most nodes carry no comments or blank lines, so instead of embedding a `NodeTrivia` (three
+/// containers) in every node this holds a single pointer that stays null until trivia is
+/// attached. The interface follows `std::optional`; copies are deep.
+class SparseTrivia final
+{
+  public:
+    SparseTrivia() = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    SparseTrivia(NodeTrivia trivia) : trivia_(std::make_unique<NodeTrivia>(std::move(trivia))) {}
+
+    ~SparseTrivia() = default;
+
+    SparseTrivia(const SparseTrivia &other) :
+      trivia_(other.trivia_ ? std::make_unique<NodeTrivia>(*other.trivia_) : nullptr)
+    {
+    }
+
+    auto operator=(const SparseTrivia &other) -> SparseTrivia &
+    {
+        if (this != &other) {
+            trivia_ = other.trivia_ ? std::make_unique<NodeTrivia>(*other.trivia_) : nullptr;
+        }
+        return *this;
+    }
+
+    SparseTrivia(SparseTrivia &&) noexcept = default;
+    auto operator=(SparseTrivia &&) noexcept -> SparseTrivia & = default;
+
+    /// @brief Attaches empty trivia, replacing any present, and returns it
+    auto emplace() -> NodeTrivia &
+    {
+        trivia_ = std::make_unique<NodeTrivia>();
+        return *trivia_;
+    }
+
+    void reset() noexcept { trivia_.reset(); }
+
+    [[nodiscard]]
+    auto has_value() const noexcept -> bool // NOLINT(readability-identifier-naming)
+    {
+        return trivia_ != nullptr;
+    }
+
+    explicit operator bool() const noexcept { return has_value(); }
+
+    /// @brief The trivia, or nullptr if the node has none
+    [[nodiscard]]
+    auto get() const noexcept -> const NodeTrivia *
+    {
+        return trivia_.get();
+    }
+
+    /// @throws std::bad_optional_access if the node has no trivia
+    [[nodiscard]]
+    auto value() const -> const NodeTrivia &
+    {
+        if (!trivia_) {
+            throw std::bad_optional_access{};
+        }
+        return *trivia_;
+    }
+
+    auto operator*() const noexcept -> const NodeTrivia & { return *trivia_; }
+    auto operator*() noexcept -> NodeTrivia & { return *trivia_; }
+    auto operator->() const noexcept -> const NodeTrivia * { return trivia_.get(); }
+    auto operator->() noexcept -> NodeTrivia * { return trivia_.get(); }
+
+  private:
+    std::unique_ptr<NodeTrivia> trivia_;
+};
+
 /// @brief Abstract base class for all AST nodes - Do not instantiate directly.
 /// @note There is no virtual destructor to leverage aggregate initialization.
 struct NodeBase
 {
-    std::optional<NodeTrivia> trivia;
+    SparseTrivia trivia;
 };
 
 } // namespace ast
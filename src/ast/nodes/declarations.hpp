@@ -2,6 +2,7 @@
 #define AST_NODES_DECLARATIONS_HPP
 
 #include "ast/node.hpp"
+#include "ast/symbol.hpp"
 #include "nodes/expressions.hpp"
 
 #include <optional>
@@ -23,7 +24,7 @@ using Declaration = std::variant<ConstantDecl, SignalDecl, GenericParam, Port>;
 // Constant declaration: constant WIDTH : integer := 8;
 struct ConstantDecl : NodeBase
 {
-    std::vector<std::string> names;
+    std::vector<Symbol> names;
     std::string type_name;
     std::optional<Expr> init_expr;
 };
@@ -31,7 +32,7 @@ struct ConstantDecl : NodeBase
 // Signal declaration: signal v : std_logic_vector(7 downto 0) := (others => '0');
 struct SignalDecl : NodeBase
 {
-    std::vector<std::string> names;
+    std::vector<Symbol> names;
     std::string type_name;
     bool has_bus_kw{ false };
     std::optional<Constraint> constraint;
@@ -41,7 +42,7 @@ struct SignalDecl : NodeBase
 // Generic parameter inside GENERIC clause
 struct GenericParam : NodeBase
 {
-    std::vector<std::string> names;
+    std::vector<Symbol> names;
     std::string type_name;
     std::optional<Expr> default_expr;
     bool is_last{};
@@ -50,7 +51,7 @@ struct GenericParam : NodeBase
 // Port entry inside PORT clause
 struct Port : NodeBase
 {
-    std::vector<std::string> names;
+    std::vector<Symbol> names;
     std::string mode; // "in" / "out"
     std::string type_name;
     std::optional<Expr> default_expr;
@@ -15,9 +15,10 @@ namespace ast {
 // Forward declarations
 struct Entity;
 struct Architecture;
+struct RawUnit;
 
 /// Variant type for all design units (holds values, not pointers)
-using DesignUnit = std::variant<Entity, Architecture>;
+using DesignUnit = std::variant<Entity, Architecture, RawUnit>;
 
 struct GenericClause : NodeBase
 {
@@ -47,6 +48,12 @@ struct Architecture : NodeBase
     std::vector<ConcurrentStatement> stmts;
 };
 
+/// @brief Source text of a design unit that failed to parse, emitted verbatim.
+struct RawUnit : NodeBase
+{
+    std::string text;
+};
+
 } // namespace ast
 
 #endif /* AST_NODES_ENTITY_HPP */
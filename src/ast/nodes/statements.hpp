@@ -3,6 +3,7 @@
 
 #include "ast/node.hpp"
 #include "ast/nodes/expressions.hpp"
+#include "ast/symbol.hpp"
 
 #include <optional>
 #include <string>
@@ -46,7 +47,7 @@ struct IfStatement : NodeBase
 {
     struct Branch
     {
-        std::optional<NodeTrivia> trivia;
+        SparseTrivia trivia;
         Expr condition; // Empty for else branch
         std::vector<SequentialStatement> body;
     };
@@ -61,7 +62,7 @@ struct CaseStatement : NodeBase
 {
     struct WhenClause
     {
-        std::optional<NodeTrivia> trivia;
+        SparseTrivia trivia;
         std::vector<Expr> choices; // Can be multiple: when 1 | 2 | 3 =>
         std::vector<SequentialStatement> body;
     };
@@ -74,7 +75,7 @@ struct CaseStatement : NodeBase
 struct Process : NodeBase
 {
     std::optional<std::string> label;
-    std::vector<std::string> sensitivity_list;
+    std::vector<Symbol> sensitivity_list;
     std::vector<SequentialStatement> body;
 };
 
@@ -0,0 +1,233 @@
+#ifndef AST_SYMBOL_HPP
+#define AST_SYMBOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ast {
+
+/// @brief Per-thread table of identifier spellings.
+///
+/// Every distinct spelling is stored once and addressed by a dense 32-bit id. Each entry also
+/// knows the id of its case-folded form, so case-insensitive comparison (as VHDL requires for
+/// basic identifiers) is an integer compare as well. Id 0 is the empty spelling.
+///
+/// Each thread interns into its own table, so neither interning nor lookups take a lock. A
+/// Symbol is therefore only meaningful on the thread that created it; the pipeline builds and
+/// prints an AST on the same thread. Entries are never dropped on their own: drivers that
+/// format many inputs call `clear()` once the ASTs of earlier inputs are gone. Every table and
+/// every `clear()` gets a process-wide unique generation, which debug builds use to catch a
+/// Symbol that outlived a `clear()` or moved to another thread.
+class SymbolTable final
+{
+  public:
+    /// @brief The table of the calling thread
+    static auto local() -> SymbolTable &
+    {
+        thread_local SymbolTable table{};
+        return table;
+    }
+
+    ~SymbolTable() = default;
+
+    SymbolTable(const SymbolTable &) = delete;
+    auto operator=(const SymbolTable &) -> SymbolTable & = delete;
+    SymbolTable(SymbolTable &&) = delete;
+    auto operator=(SymbolTable &&) -> SymbolTable & = delete;
+
+    /// @brief Returns the id of `text`, adding it on first use
+    auto intern(const std::string_view text) -> std::uint32_t
+    {
+        if (const auto it = ids_.find(text); it != ids_.end()) {
+            return it->second;
+        }
+
+        const auto folded = fold(text);
+        const bool is_folded = folded == text;
+        const auto folded_id = is_folded ? 0U : intern(folded);
+        const auto own_id = static_cast<std::uint32_t>(entries_.size());
+
+        // Deque elements never move, so the views into storage_ stay valid
+        const std::string_view stored = storage_.emplace_back(text);
+        entries_.push_back(Entry{ .spelling = stored, .folded = is_folded ? own_id : folded_id });
+        ids_.emplace(stored, own_id);
+        return own_id;
+    }
+
+    /// @brief Original spelling of an interned id
+    [[nodiscard]]
+    auto spelling(const std::uint32_t id) const -> std::string_view
+    {
+        return entries_.at(id).spelling;
+    }
+
+    /// @brief Id of the case-folded spelling of an interned id
+    [[nodiscard]]
+    auto foldedId(const std::uint32_t id) const -> std::uint32_t
+    {
+        return entries_.at(id).folded;
+    }
+
+    /// @brief Number of distinct spellings, including their folded forms
+    [[nodiscard]]
+    auto size() const noexcept -> std::size_t
+    {
+        return entries_.size();
+    }
+
+    /// @brief Generation of the current contents, unique across threads and `clear()` calls
+    [[nodiscard]]
+    auto generation() const noexcept -> std::uint32_t
+    {
+        return generation_;
+    }
+
+    /// @brief Drop every spelling; Symbols created before on this thread must not be used after
+    void clear()
+    {
+        ids_.clear();
+        entries_.clear();
+        storage_.clear();
+        generation_ = nextGeneration();
+        intern({});
+    }
+
+  private:
+    struct Entry final
+    {
+        std::string_view spelling;
+        std::uint32_t folded{};
+    };
+
+    SymbolTable() { intern({}); }
+
+    static auto nextGeneration() noexcept -> std::uint32_t
+    {
+        static std::atomic<std::uint32_t> next{ 1 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Lowercase key of a basic identifier.
+    ///
+    /// Extended identifiers (`\Name\`) are case-sensitive, and anything that is not a basic
+    /// identifier (character, string, bit-string and numeric literals) is its own key.
+    static auto fold(const std::string_view text) -> std::string
+    {
+        const auto is_letter = [](const char c) {
+            return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+        };
+        const auto is_word = [&is_letter](const char c) {
+            return is_letter(c) || (c >= '0' && c <= '9') || c == '_';
+        };
+
+        std::string folded{ text };
+        if (!text.empty() && is_letter(text.front()) && std::ranges::all_of(text, is_word)) {
+            for (auto &c : folded) {
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+            }
+        }
+        return folded;
+    }
+
+    std::deque<std::string> storage_;
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string_view, std::uint32_t> ids_;
+    std::uint32_t generation_{ nextGeneration() };
+};
+
+/// @brief An interned identifier: a 32-bit handle into the SymbolTable of its thread.
+///
+/// Constructible from any string so AST nodes can be filled with plain text; equality compares
+/// the handles only. Debug builds also record the table generation and assert on it whenever
+/// the spelling is looked up.
+class Symbol final
+{
+  public:
+    Symbol() = default;
+
+    // NOLINTBEGIN(google-explicit-constructor, hicpp-explicit-conversions)
+    Symbol(const std::string_view text) : Symbol(SymbolTable::local().intern(text), FromId{}) {}
+    Symbol(const char *text) : Symbol(std::string_view{ text }) {}
+    Symbol(const std::string &text) : Symbol(std::string_view{ text }) {}
+    // NOLINTEND(google-explicit-constructor, hicpp-explicit-conversions)
+
+    /// @brief Dense id of the exact spelling
+    [[nodiscard]]
+    auto id() const noexcept -> std::uint32_t
+    {
+        return id_;
+    }
+
+    /// @brief The original spelling, as written in the source
+    [[nodiscard]]
+    auto view() const -> std::string_view
+    {
+        checkTable();
+        return SymbolTable::local().spelling(id_);
+    }
+
+    /// @brief The case-folded symbol, used as key by case-insensitive lookups
+    [[nodiscard]]
+    auto folded() const -> Symbol
+    {
+        checkTable();
+        return Symbol{ SymbolTable::local().foldedId(id_), FromId{} };
+    }
+
+    /// @brief Case-insensitive identifier equality
+    [[nodiscard]]
+    auto equalsFolded(const Symbol other) const -> bool
+    {
+        return folded() == other.folded();
+    }
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool
+    {
+        return id_ == 0;
+    }
+
+    friend auto operator==(const Symbol lhs, const Symbol rhs) noexcept -> bool
+    {
+        return lhs.id_ == rhs.id_;
+    }
+
+  private:
+    struct FromId final
+    {};
+
+    Symbol(const std::uint32_t id, FromId /*tag*/) : id_(id)
+    {
+#ifndef NDEBUG
+        generation_ = SymbolTable::local().generation();
+#endif
+    }
+
+    /// @brief Id 0, the empty spelling, is valid in every table
+    void checkTable() const noexcept
+    {
+#ifndef NDEBUG
+        assert((id_ == 0 || generation_ == SymbolTable::local().generation())
+               && "Symbol used after SymbolTable::clear() or on another thread");
+#endif
+    }
+
+    std::uint32_t id_{ 0 };
+#ifndef NDEBUG
+    std::uint32_t generation_{ 0 };
+#endif
+};
+
+} // namespace ast
+
+#endif /* AST_SYMBOL_HPP */
@@ -1,119 +1,489 @@
 #include "builder/ast_builder.hpp"
 
 #include "ast/nodes/design_file.hpp"
+#include "builder/fast_parser.hpp"
+#include "builder/parser_profile.hpp"
 #include "builder/translator.hpp"
+#include "common/stats.hpp"
+#include "common/trace.hpp"
 #include "vhdlLexer.h"
 #include "vhdlParser.h"
 
 #include <ANTLRInputStream.h>
 #include <CommonTokenStream.h>
+#include <Token.h>
 #include <antlr4-runtime/BailErrorStrategy.h>
 #include <antlr4-runtime/ConsoleErrorListener.h>
 #include <antlr4-runtime/DefaultErrorStrategy.h>
 #include <antlr4-runtime/Exceptions.h>
+#include <antlr4-runtime/RecognitionException.h>
+#include <antlr4-runtime/atn/ATN.h>
 #include <antlr4-runtime/atn/ParserATNSimulator.h>
+#include <antlr4-runtime/atn/PredictionContextCache.h>
+#include <antlr4-runtime/atn/ProfilingATNSimulator.h>
 #include <antlr4-runtime/atn/PredictionMode.h>
+#include <antlr4-runtime/dfa/DFA.h>
+#include <cstddef>
+#include <exception>
 #include <filesystem>
+#include <format>
 #include <fstream>
 #include <istream>
 #include <memory>
+#include <ranges>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace builder {
 
-namespace {
-
 struct ParsingContext
 {
     std::unique_ptr<antlr4::ANTLRInputStream> input;
     std::unique_ptr<vhdlLexer> lexer;
     std::unique_ptr<antlr4::CommonTokenStream> tokens;
     std::unique_ptr<vhdlParser> parser;
-    vhdlParser::Design_fileContext *tree{};
+    DfaCache dfa_cache{ DfaCache::SHARED }; ///< Cache the parser was set up with
 };
 
-auto createParsingContext(std::unique_ptr<antlr4::ANTLRInputStream> input_stream) -> ParsingContext
+namespace {
+
+/// @brief Record the memory use at the end of `phase`, if statistics were requested
+void sampleMemory(const BuildOptions &options, const common::Phase phase)
 {
-    ParsingContext ctx;
-    ctx.input = std::move(input_stream);
-    ctx.lexer = std::make_unique<vhdlLexer>(ctx.input.get());
-    ctx.tokens = std::make_unique<antlr4::CommonTokenStream>(ctx.lexer.get());
-    ctx.tokens->fill();
-    ctx.parser = std::make_unique<vhdlParser>(ctx.tokens.get());
+    if (options.stats != nullptr) {
+        options.stats->sampleMemory(phase);
+    }
+}
 
-    return ctx;
+/// @brief Release every parse tree node and continue parsing at the given token.
+///
+/// The C++ runtime owns all contexts in the parser's tracker, so individual subtrees cannot
+/// be freed. Resetting the parser drops them all (and rewinds the stream, hence the seek).
+void releaseParseTree(ParsingContext &ctx, const std::size_t resume_index)
+{
+    ctx.parser->reset();
+    ctx.tokens->seek(resume_index);
 }
 
-void executeParse(ParsingContext &ctx)
+auto makeDecisionDfa(const antlr4::atn::ATN &atn) -> std::vector<antlr4::dfa::DFA>
 {
-    auto *interpreter = ctx.parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+    std::vector<antlr4::dfa::DFA> decision_to_dfa{};
+    decision_to_dfa.reserve(atn.getNumberOfDecisions());
+    for (std::size_t i = 0; i < atn.getNumberOfDecisions(); ++i) {
+        decision_to_dfa.emplace_back(atn.getDecisionState(i), i);
+    }
+    return decision_to_dfa;
+}
+
+/// @brief Point the parser at a DFA cache owned by the calling thread.
+///
+/// The generated parser shares one DFA and prediction context cache between all instances,
+/// and the runtime takes a lock for every update, which serializes parallel parsing.
+/// A thread-local copy is only ever touched by its own thread.
+void usePerThreadDfa(vhdlParser &parser)
+{
+    struct ThreadDfa final
+    {
+        std::vector<antlr4::dfa::DFA> decision_to_dfa;
+        antlr4::atn::PredictionContextCache context_cache;
+    };
 
-    // Preemptive SLL Parsing Attempt
+    const auto &atn = parser.getATN();
+    thread_local ThreadDfa cache{ .decision_to_dfa = makeDecisionDfa(atn) };
+
+    // The recognizer does not own a replaced interpreter, so release it here
+    auto *previous = parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+    parser.setInterpreter(new antlr4::atn::ParserATNSimulator(
+      &parser, atn, cache.decision_to_dfa, cache.context_cache));
+    delete previous; // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+/// @brief Install a fresh profiler if the build is profiled, else make sure none is left.
+///
+/// `Parser::setProfile` leaks the interpreter it replaces, so the swap is done here. Both
+/// simulators are built on the current interpreter's DFA, which keeps a per-thread cache.
+void useProfiler(vhdlParser &parser, const bool profile)
+{
+    auto *previous = parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+    const bool profiling = dynamic_cast<antlr4::atn::ProfilingATNSimulator *>(previous) != nullptr;
+
+    if (profile) {
+        // Always a new one: the profiler accumulates its decision info over all parses
+        parser.setInterpreter(new antlr4::atn::ProfilingATNSimulator(&parser));
+    } else if (profiling) {
+        parser.setInterpreter(new antlr4::atn::ParserATNSimulator(
+          &parser, parser.getATN(), previous->decisionToDFA, previous->getSharedContextCache()));
+    } else {
+        return;
+    }
+    delete previous; // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+void useSllMode(ParsingContext &ctx)
+{
+    auto *interpreter = ctx.parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
     interpreter->setPredictionMode(antlr4::atn::PredictionMode::SLL);
 
     // Replace default error strategy with BailErrorStrategy (throws on first error)
     ctx.parser->setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
     ctx.parser->removeErrorListeners(); // Silence console errors during fast pass
+}
+
+void useLlMode(ParsingContext &ctx, const BuildOptions &options)
+{
+    auto *interpreter = ctx.parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+    interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
+
+    // Keep bailing: the first genuine error either ends the run or skips the unit
+    if (options.fail_fast || options.resilient) {
+        return;
+    }
+
+    // Restore default error handling so user sees useful error messages
+    ctx.parser->addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+    ctx.parser->setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+}
+
+/// @brief Build an error message from the recognition error wrapped by BailErrorStrategy
+auto describeSyntaxError(const antlr4::ParseCancellationException &error) -> std::string
+{
+    try {
+        std::rethrow_if_nested(error);
+    } catch (const antlr4::RecognitionException &inner) {
+        if (const auto *token = inner.getOffendingToken()) {
+            return std::format("Syntax error at line {}:{} near '{}'",
+                               token->getLine(),
+                               token->getCharPositionInLine(),
+                               token->getText());
+        }
+    } catch (...) {
+        // Fall through to the generic message
+    }
+    return "Syntax error";
+}
+
+/// @brief Locate the broken region starting at `unit_start` and the unit that follows it.
+///
+/// The next unit begins at an `entity`, `architecture` or `package` keyword right after a
+/// `;`, together with any `library`/`use` clauses in front of it. The broken unit's own
+/// context clauses and keyword are skipped first, so the search never stops at the unit itself.
+/// @return Index of the last token of the broken region and the index to resume at
+auto findBrokenUnitEnd(const antlr4::CommonTokenStream &tokens, const std::size_t unit_start)
+  -> std::pair<std::size_t, std::size_t>
+{
+    std::vector<std::size_t> visible{};
+    for (const auto *token : tokens.getTokens() | std::views::drop(unit_start)) {
+        if (token->getChannel() == antlr4::Token::DEFAULT_CHANNEL) {
+            visible.push_back(token->getTokenIndex());
+        }
+    }
+
+    const auto type_at = [&](const std::size_t pos) -> std::size_t {
+        return tokens.get(visible[pos])->getType();
+    };
+    const auto is_unit_keyword = [&](const std::size_t pos) -> bool {
+        const auto type = type_at(pos);
+        return type == vhdlParser::ENTITY
+            || type == vhdlParser::ARCHITECTURE
+            || type == vhdlParser::PACKAGE;
+    };
+
+    const auto is_context_keyword = [&](const std::size_t pos) -> bool {
+        const auto type = type_at(pos);
+        return type == vhdlParser::LIBRARY || type == vhdlParser::USE;
+    };
+
+    // Position of the broken unit's library-unit keyword, past its own context clauses
+    std::size_t unit_keyword = 0;
+    while (unit_keyword + 1 < visible.size() && is_context_keyword(unit_keyword)) {
+        while (unit_keyword + 1 < visible.size() && type_at(unit_keyword) != vhdlParser::SEMI) {
+            ++unit_keyword;
+        }
+        ++unit_keyword;
+    }
+
+    // The last visible token is EOF; if nothing else follows, the rest of the file is raw
+    std::size_t resume = visible.size() - 1;
+    for (std::size_t pos = unit_keyword + 1; pos + 1 < visible.size(); ++pos) {
+        if (type_at(pos - 1) == vhdlParser::SEMI && is_unit_keyword(pos)) {
+            resume = pos;
+            break;
+        }
+    }
+
+    // Pull the preceding context clauses along, but never back into the broken unit
+    while (resume + 1 < visible.size()) {
+        auto clause_start = resume - 1;
+        while (clause_start > unit_keyword && type_at(clause_start - 1) != vhdlParser::SEMI) {
+            --clause_start;
+        }
+        if (clause_start <= unit_keyword || !is_context_keyword(clause_start)) {
+            break;
+        }
+        resume = clause_start;
+    }
+
+    return { visible[resume - 1], visible[resume] };
+}
+
+/// @brief Parse the design unit starting at the current token.
+///
+/// SLL is tried first. If it bails, only this unit is rewound and parsed again with full LL
+/// analysis; units that were already translated are kept.
+/// @return The unit, or nullptr if it is broken and the build is resilient
+auto parseDesignUnit(ParsingContext &ctx, const BuildOptions &options)
+  -> vhdlParser::Design_unitContext *
+{
+    const auto unit_start = ctx.tokens->index();
 
     try {
-        ctx.tree = ctx.parser->design_file();
+        const common::TraceSpan span("SLL parse unit");
+        return ctx.parser->design_unit();
     } catch (const antlr4::ParseCancellationException &) {
-        // SLL failed. Rewind stream and reset parser for full LL analysis.
-        (*ctx.tokens).reset();
-        (*ctx.parser).reset();
-
-        // Restore default error handling so user sees useful error messages
-        ctx.parser->addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
-        ctx.parser->setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+        // SLL failed. Rewind to the start of this unit for full LL analysis.
+        releaseParseTree(ctx, unit_start);
+    }
 
-        interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
-        ctx.tree = ctx.parser->design_file();
+    if (options.stats != nullptr) {
+        ++options.stats->ll_retries;
     }
 
-    if (ctx.tree == nullptr) {
-        throw std::runtime_error("Parser returned null tree. Unknown parsing error.");
+    const common::TraceSpan span("LL fallback");
+    useLlMode(ctx, options);
+
+    try {
+        auto *unit = ctx.parser->design_unit();
+        useSllMode(ctx);
+        return unit;
+    } catch (const antlr4::ParseCancellationException &error) {
+        // Only reachable in fail-fast or resilient mode, where the LL pass bails as well
+        if (!options.resilient) {
+            throw std::runtime_error(describeSyntaxError(error));
+        }
     }
+
+    useSllMode(ctx);
+    return nullptr;
 }
 
-auto translateToAST(ParsingContext &ctx) -> ast::DesignFile
+/// @brief Parse and translate one design unit at a time.
+///
+/// Each unit is handed to the Translator as soon as its rule exits and its parse tree is
+/// released right after, so only a single unit's CST is alive next to the growing AST.
+/// In resilient mode a broken unit is kept as raw text up to the start of the next unit.
+auto executeParse(ParsingContext &ctx, const BuildOptions &options) -> ast::DesignFile
 {
+    const common::TraceSpan span("ANTLR parse");
+
+    // Created lazily: inputs handled by the fast path never need the ANTLR parser
+    if (ctx.parser == nullptr || ctx.dfa_cache != options.dfa_cache) {
+        const common::PhaseTimer timer(options.stats, common::Phase::SETUP);
+        ctx.parser = std::make_unique<vhdlParser>(ctx.tokens.get());
+        ctx.dfa_cache = options.dfa_cache;
+        if (options.dfa_cache == DfaCache::PER_THREAD) {
+            usePerThreadDfa(*ctx.parser);
+        }
+    } else {
+        ctx.parser->setTokenStream(ctx.tokens.get());
+    }
+
+    useProfiler(*ctx.parser, options.profile != nullptr);
+    useSllMode(ctx);
+
     ast::DesignFile root{};
-    Translator translator(*ctx.tokens);
-    translator.buildDesignFile(root, ctx.tree);
+    Translator translator(*ctx.tokens, options.stats);
+
+    while (ctx.tokens->LA(1) != antlr4::Token::EOF) {
+        const auto unit_start = ctx.tokens->index();
+
+        auto *unit = [&] {
+            const common::PhaseTimer timer(options.stats, common::Phase::PARSE);
+            return parseDesignUnit(ctx, options);
+        }();
+        // The unit's parse tree is alive here, so this is its high-water mark
+        sampleMemory(options, common::Phase::PARSE);
+
+        if (unit == nullptr) {
+            const common::PhaseTimer timer(options.stats, common::Phase::TRANSLATE);
+            const auto [raw_stop, resume_index] = findBrokenUnitEnd(*ctx.tokens, unit_start);
+            translator.buildRawUnit(root, unit_start, raw_stop);
+            releaseParseTree(ctx, resume_index);
+            continue;
+        }
+
+        {
+            const common::PhaseTimer timer(options.stats, common::Phase::TRANSLATE);
+            translator.buildDesignUnit(root, unit);
+        }
+        // Parse tree and new AST nodes are both alive; sampled outside the timer, like PARSE
+        sampleMemory(options, common::Phase::TRANSLATE);
+
+        // Releasing the parse tree is charged to translation, as for a broken unit
+        const common::PhaseTimer timer(options.stats, common::Phase::TRANSLATE);
+        // Error recovery may stop without consuming anything; always make progress
+        if (ctx.tokens->index() == unit_start) {
+            ctx.tokens->consume();
+        }
+        releaseParseTree(ctx, ctx.tokens->index());
+    }
+
+    if (options.profile != nullptr) {
+        *options.profile = collectProfile(*ctx.parser);
+    }
+
     return root;
 }
 
+auto buildAST(ParsingContext &ctx, const BuildOptions &options) -> ast::DesignFile
+{
+    // Profiling is about the ANTLR grammar, so it never takes the fast path
+    if (options.frontend == Frontend::AUTO && options.profile == nullptr) {
+        const common::PhaseTimer timer(options.stats, common::Phase::PARSE);
+        const common::TraceSpan span("fast parse");
+        FastParser fast_parser(*ctx.tokens, options.stats);
+        if (auto root = fast_parser.parseDesignFile()) {
+            sampleMemory(options, common::Phase::PARSE);
+            if (options.stats != nullptr) {
+                options.stats->fast_path = true;
+            }
+            return std::move(*root);
+        }
+        // The nodes bound by the abandoned attempt are bound again by the Translator
+        if (options.stats != nullptr) {
+            options.stats->ast_nodes = 0;
+        }
+    }
+
+    return executeParse(ctx, options);
+}
+
 } // namespace
 
-auto buildFromFile(const std::filesystem::path &path) -> ast::DesignFile
+// ---------------------- Session ----------------------
+
+Session::Session() : ctx_(std::make_unique<ParsingContext>())
+{
+    ctx_->input = std::make_unique<antlr4::ANTLRInputStream>();
+    ctx_->lexer = std::make_unique<vhdlLexer>(ctx_->input.get());
+    ctx_->tokens = std::make_unique<antlr4::CommonTokenStream>(ctx_->lexer.get());
+}
+
+Session::~Session() = default;
+Session::Session(Session &&) noexcept = default;
+auto Session::operator=(Session &&) noexcept -> Session & = default;
+
+auto Session::build(const BuildOptions &options) -> ast::DesignFile
+{
+    // Resetting instead of recreating keeps the lexer's and token buffer's storage
+    ctx_->lexer->setInputStream(ctx_->input.get());
+    ctx_->tokens->setTokenSource(ctx_->lexer.get());
+    {
+        const common::PhaseTimer timer(options.stats, common::Phase::LEX);
+        const common::TraceSpan span("lex");
+        ctx_->tokens->fill();
+    }
+    sampleMemory(options, common::Phase::LEX);
+    if (options.stats != nullptr) {
+        options.stats->tokens = ctx_->tokens->size();
+    }
+
+    return buildAST(*ctx_, options);
+}
+
+auto Session::buildFromFile(const std::filesystem::path &path) -> ast::DesignFile
+{
+    return buildFromFile(path, BuildOptions{});
+}
+
+auto Session::buildFromFile(const std::filesystem::path &path, const BuildOptions &options)
+  -> ast::DesignFile
 {
     std::ifstream file(path);
     if (!file) {
         throw std::runtime_error("Failed to open input file: " + path.string());
     }
-    return buildFromStream(file);
+    return buildFromStream(file, options);
 }
 
-auto buildFromStream(std::istream &input) -> ast::DesignFile
+auto Session::buildFromStream(std::istream &input) -> ast::DesignFile
 {
-    auto antlr_input = std::make_unique<antlr4::ANTLRInputStream>(input);
-    auto ctx = createParsingContext(std::move(antlr_input));
+    return buildFromStream(input, BuildOptions{});
+}
 
-    executeParse(ctx);
+auto Session::buildFromStream(std::istream &input, const BuildOptions &options)
+  -> ast::DesignFile
+{
+    {
+        const common::PhaseTimer timer(options.stats, common::Phase::READ);
+        const common::TraceSpan span("read");
+        ctx_->input->load(input);
+    }
+    sampleMemory(options, common::Phase::READ);
+    return build(options);
+}
 
-    return translateToAST(ctx);
+auto Session::buildFromString(std::string_view vhdl_code) -> ast::DesignFile
+{
+    return buildFromString(vhdl_code, BuildOptions{});
 }
 
-auto buildFromString(std::string_view vhdl_code) -> ast::DesignFile
+auto Session::buildFromString(std::string_view vhdl_code, const BuildOptions &options)
+  -> ast::DesignFile
+{
+    {
+        const common::PhaseTimer timer(options.stats, common::Phase::READ);
+        const common::TraceSpan span("read");
+        ctx_->input->load(vhdl_code.data(), vhdl_code.size());
+    }
+    sampleMemory(options, common::Phase::READ);
+    return build(options);
+}
+
+// ---------------------- One-shot builds ----------------------
+
+namespace {
+
+/// @brief A fresh session, its lexer construction timed as setup
+auto makeSession(const BuildOptions &options) -> Session
+{
+    const common::PhaseTimer timer(options.stats, common::Phase::SETUP);
+    return Session{};
+}
+
+} // namespace
+
+auto buildFromFile(const std::filesystem::path &path) -> ast::DesignFile
 {
-    auto antlr_input = std::make_unique<antlr4::ANTLRInputStream>(vhdl_code);
-    auto ctx = createParsingContext(std::move(antlr_input));
+    return buildFromFile(path, BuildOptions{});
+}
+
+auto buildFromFile(const std::filesystem::path &path, const BuildOptions &options)
+  -> ast::DesignFile
+{
+    return makeSession(options).buildFromFile(path, options);
+}
 
-    executeParse(ctx);
+auto buildFromStream(std::istream &input) -> ast::DesignFile
+{
+    return buildFromStream(input, BuildOptions{});
+}
 
-    return translateToAST(ctx);
+auto buildFromStream(std::istream &input, const BuildOptions &options) -> ast::DesignFile
+{
+    return makeSession(options).buildFromStream(input, options);
+}
+
+auto buildFromString(std::string_view vhdl_code) -> ast::DesignFile
+{
+    return buildFromString(vhdl_code, BuildOptions{});
+}
+
+auto buildFromString(std::string_view vhdl_code, const BuildOptions &options) -> ast::DesignFile
+{
+    return makeSession(options).buildFromString(vhdl_code, options);
 }
 
 } // namespace builder
@@ -2,13 +2,48 @@
 #define BUILDER_AST_BUILDER_HPP
 
 #include "ast/nodes/design_file.hpp"
+#include "builder/parser_profile.hpp"
 
+#include <cstdint>
 #include <filesystem>
 #include <istream>
+#include <memory>
 #include <string_view>
 
+namespace common {
+struct PipelineStats;
+} // namespace common
+
 namespace builder {
 
+/// @brief Front-end used to turn the token stream into an AST
+enum class Frontend : std::uint8_t
+{
+    AUTO,  ///< Hand-written parser, falling back to ANTLR for unsupported constructs
+    ANTLR, ///< Always go through the ANTLR parse tree and the Translator
+};
+
+/// @brief Prediction (DFA) cache used by the ANTLR parser
+enum class DfaCache : std::uint8_t
+{
+    SHARED,     ///< One cache for the whole process, as generated by ANTLR
+    PER_THREAD, ///< One cache per thread: never contended, but each thread warms up its own
+};
+
+/// @brief Options controlling how the AST is built
+struct BuildOptions final
+{
+    Frontend frontend{ Frontend::AUTO };
+    DfaCache dfa_cache{ DfaCache::SHARED };
+    bool fail_fast{ false }; ///< Throw on the first syntax error instead of recovering
+    bool resilient{ false }; ///< Keep units with syntax errors verbatim, format the rest
+    /// Filled with per-decision statistics of the ANTLR parser when set (implies ANTLR)
+    ParserProfile *profile{ nullptr };
+    /// Accumulates time, allocations and counts of the read, lex, parse, translate and
+    /// trivia phases when set
+    common::PipelineStats *stats{ nullptr };
+};
+
 /// @brief Build AST from a file path
 ///
 /// Encapsulates the entire ANTLR parsing pipeline (lexer, parser, token stream)
@@ -20,6 +55,15 @@ namespace builder {
 [[nodiscard]]
 auto buildFromFile(const std::filesystem::path &path) -> ast::DesignFile;
 
+/// @brief Build AST from a file path with explicit build options
+/// @param path Path to VHDL source file
+/// @param options Build options (front-end selection)
+/// @return Populated DesignFile AST
+/// @throws std::runtime_error if file cannot be opened or parsed
+[[nodiscard]]
+auto buildFromFile(const std::filesystem::path &path, const BuildOptions &options)
+  -> ast::DesignFile;
+
 /// @brief Build AST from an input stream
 /// @param input Input stream containing VHDL source code
 /// @return Populated DesignFile AST
@@ -27,6 +71,14 @@ auto buildFromFile(const std::filesystem::path &path) -> ast::DesignFile;
 [[nodiscard]]
 auto buildFromStream(std::istream &input) -> ast::DesignFile;
 
+/// @brief Build AST from an input stream with explicit build options
+/// @param input Input stream containing VHDL source code
+/// @param options Build options (front-end selection)
+/// @return Populated DesignFile AST
+/// @throws std::runtime_error if parsing fails
+[[nodiscard]]
+auto buildFromStream(std::istream &input, const BuildOptions &options) -> ast::DesignFile;
+
 /// @brief Build AST from a string
 /// @param vhdl_code VHDL source code as string
 /// @return Populated DesignFile AST
@@ -34,6 +86,67 @@ auto buildFromStream(std::istream &input) -> ast::DesignFile;
 [[nodiscard]]
 auto buildFromString(std::string_view vhdl_code) -> ast::DesignFile;
 
+/// @brief Build AST from a string with explicit build options
+/// @param vhdl_code VHDL source code as string
+/// @param options Build options (front-end selection)
+/// @return Populated DesignFile AST
+/// @throws std::runtime_error if parsing fails
+[[nodiscard]]
+auto buildFromString(std::string_view vhdl_code, const BuildOptions &options) -> ast::DesignFile;
+
+struct ParsingContext;
+
+/// @brief Reusable parsing pipeline for building many inputs in a row.
+///
+/// Owns the input stream, lexer, token buffer and parser and points them at each new input
+/// instead of constructing them per file, so their buffers and interpreter setup are kept.
+/// A session is not thread-safe; use one per thread, and with `DfaCache::PER_THREAD` keep it
+/// on the thread that first built with it. Identifiers are interned into the calling thread's
+/// `ast::SymbolTable`, which a long batch clears between inputs once their ASTs are released.
+class Session final
+{
+  public:
+    Session();
+    ~Session();
+
+    Session(const Session &) = delete;
+    auto operator=(const Session &) -> Session & = delete;
+    Session(Session &&) noexcept;
+    auto operator=(Session &&) noexcept -> Session &;
+
+    /// @brief Build AST from a file path, see `builder::buildFromFile`
+    [[nodiscard]]
+    auto buildFromFile(const std::filesystem::path &path) -> ast::DesignFile;
+
+    /// @brief Build AST from a file path with explicit build options
+    [[nodiscard]]
+    auto buildFromFile(const std::filesystem::path &path, const BuildOptions &options)
+      -> ast::DesignFile;
+
+    /// @brief Build AST from an input stream, see `builder::buildFromStream`
+    [[nodiscard]]
+    auto buildFromStream(std::istream &input) -> ast::DesignFile;
+
+    /// @brief Build AST from an input stream with explicit build options
+    [[nodiscard]]
+    auto buildFromStream(std::istream &input, const BuildOptions &options) -> ast::DesignFile;
+
+    /// @brief Build AST from a string, see `builder::buildFromString`
+    [[nodiscard]]
+    auto buildFromString(std::string_view vhdl_code) -> ast::DesignFile;
+
+    /// @brief Build AST from a string with explicit build options
+    [[nodiscard]]
+    auto buildFromString(std::string_view vhdl_code, const BuildOptions &options)
+      -> ast::DesignFile;
+
+  private:
+    std::unique_ptr<ParsingContext> ctx_;
+
+    /// @brief Re-lex the freshly loaded input and build its AST
+    auto build(const BuildOptions &options) -> ast::DesignFile;
+};
+
 } // namespace builder
 
 #endif /* BUILDER_AST_BUILDER_HPP */
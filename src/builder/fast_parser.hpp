@@ -0,0 +1,289 @@
+#ifndef BUILDER_FAST_PARSER_HPP
+#define BUILDER_FAST_PARSER_HPP
+
+#include "ast/nodes/declarations.hpp"
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "ast/nodes/expressions.hpp"
+#include "ast/nodes/statements.hpp"
+#include "builder/trivia/trivia_binder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace antlr4 {
+class CommonTokenStream;
+class Token;
+} // namespace antlr4
+
+namespace common {
+struct PipelineStats;
+} // namespace common
+
+namespace builder {
+
+/// @brief Hand-written recursive-descent parser for the VHDL subset consumed by the Translator.
+///
+/// Builds AST nodes straight from the token stream, skipping the ANTLR parse tree. Nodes are
+/// created and bound to trivia in the same order and with the same token spans as the
+/// Translator, so both front-ends produce identical ASTs. Any construct outside the supported
+/// subset (or any ambiguity the ANTLR grammar resolves in a non-obvious way) aborts the parse,
+/// and the caller falls back to the ANTLR path.
+class FastParser final
+{
+  public:
+    explicit FastParser(antlr4::CommonTokenStream &tokens);
+
+    /// @brief Parser whose bound nodes are counted into `stats`, if not null
+    FastParser(antlr4::CommonTokenStream &tokens, common::PipelineStats *stats);
+
+    ~FastParser() = default;
+
+    FastParser(const FastParser &) = delete;
+    auto operator=(const FastParser &) -> FastParser & = delete;
+    FastParser(FastParser &&) = delete;
+    auto operator=(FastParser &&) -> FastParser & = delete;
+
+    /// @brief Parse the whole token stream into a design file
+    /// @return The AST, or std::nullopt if the input leaves the supported subset
+    [[nodiscard]]
+    auto parseDesignFile() -> std::optional<ast::DesignFile>;
+
+  private:
+    /// @brief Thrown internally when the input leaves the supported subset
+    struct Unsupported final : std::runtime_error
+    {
+        Unsupported() : std::runtime_error("unsupported construct") {}
+    };
+
+    /// @brief Binary operator levels of the grammar, loosest first
+    enum class Precedence : std::uint8_t
+    {
+        NONE,
+        LOGICAL,     ///< expression
+        RELATIONAL,  ///< relation
+        SHIFT,       ///< shift_expression
+        ADDING,      ///< simple_expression
+        MULTIPLYING, ///< term
+        EXPONENT,    ///< factor
+        PRIMARY,     ///< primary, no binary operator
+    };
+
+    TriviaBinder trivia_;
+    std::vector<antlr4::Token *> tokens_; ///< Default-channel tokens, terminated by EOF
+    std::size_t pos_{ 0 };
+    bool bind_{ true }; ///< Cleared while validating constructs the Translator does not bind
+
+    // Design units
+    void parseContextClause();
+    [[nodiscard]]
+    auto parseEntity() -> ast::Entity;
+    [[nodiscard]]
+    auto parseArchitecture() -> ast::Architecture;
+
+    // Clauses
+    [[nodiscard]]
+    auto parseGenericClause() -> ast::GenericClause;
+    [[nodiscard]]
+    auto parsePortClause() -> ast::PortClause;
+
+    // Declarations
+    [[nodiscard]]
+    auto parseGenericParam() -> ast::GenericParam;
+    [[nodiscard]]
+    auto parseSignalPort() -> ast::Port;
+    [[nodiscard]]
+    auto parseConstantDecl() -> ast::ConstantDecl;
+    [[nodiscard]]
+    auto parseSignalDecl() -> ast::SignalDecl;
+    [[nodiscard]]
+    auto parseIdentifierList() -> std::vector<ast::Symbol>;
+    [[nodiscard]]
+    auto parseSelectedName() -> std::string;
+    [[nodiscard]]
+    auto parseTypeMark() -> std::string;
+
+    // Constraints
+    [[nodiscard]]
+    auto parseConstraint() -> std::optional<ast::Constraint>;
+    [[nodiscard]]
+    auto parseIndexConstraint() -> ast::IndexConstraint;
+    [[nodiscard]]
+    auto parseRangeConstraint() -> std::optional<ast::RangeConstraint>;
+
+    // Statements
+    [[nodiscard]]
+    auto parseConcurrentStatement() -> ast::ConcurrentStatement;
+    [[nodiscard]]
+    auto parseConcurrentAssign() -> ast::ConcurrentAssign;
+    [[nodiscard]]
+    auto parseProcess() -> ast::Process;
+    [[nodiscard]]
+    auto parseSensitivityName() -> std::string;
+    void parseProcessDeclarativePart();
+    [[nodiscard]]
+    auto parseSequentialStatement() -> ast::SequentialStatement;
+    [[nodiscard]]
+    auto parseSequenceOfStatements() -> std::vector<ast::SequentialStatement>;
+    [[nodiscard]]
+    auto parseSequentialAssign() -> ast::SequentialAssign;
+    [[nodiscard]]
+    auto parseVariableAssign() -> ast::SequentialAssign;
+    [[nodiscard]]
+    auto parseWaveformValue() -> ast::Expr;
+    void parseDelayMechanism();
+    [[nodiscard]]
+    auto parseIfStatement() -> ast::IfStatement;
+    [[nodiscard]]
+    auto parseCaseStatement() -> ast::CaseStatement;
+    [[nodiscard]]
+    auto parseForLoop() -> ast::ForLoop;
+    [[nodiscard]]
+    auto parseWhileLoop() -> ast::WhileLoop;
+    [[nodiscard]]
+    auto parseUntranslatedStatement() -> ast::SequentialStatement;
+
+    // Expressions
+    [[nodiscard]]
+    auto parseExpr() -> ast::Expr;
+    [[nodiscard]]
+    auto parseSimpleExpr() -> ast::Expr;
+    [[nodiscard]]
+    auto parseBinary(Precedence min_level) -> ast::Expr;
+    [[nodiscard]]
+    auto parseOperand(Precedence min_level) -> ast::Expr;
+    [[nodiscard]]
+    static auto precedenceOf(std::size_t type) noexcept -> Precedence;
+    void bindChainEnd(ast::NodeBase &node, std::size_t first, Precedence level);
+    [[nodiscard]]
+    auto parsePrimary() -> ast::Expr;
+    [[nodiscard]]
+    auto parseAggregate() -> ast::Expr;
+    [[nodiscard]]
+    auto parseChoices() -> ast::Expr;
+    [[nodiscard]]
+    auto parseChoice() -> ast::Expr;
+    [[nodiscard]]
+    auto parseRange() -> ast::Expr;
+    [[nodiscard]]
+    auto parseTarget() -> ast::Expr;
+    [[nodiscard]]
+    auto parseName() -> ast::Expr;
+    [[nodiscard]]
+    auto parseCallExpr(ast::Expr base) -> ast::Expr;
+    [[nodiscard]]
+    auto parseSliceExpr(ast::Expr base) -> ast::Expr;
+    [[nodiscard]]
+    auto parseAttributeExpr(ast::Expr base) -> ast::Expr;
+    [[nodiscard]]
+    auto parseCallArgument() -> ast::Expr;
+
+    // Token access
+    [[noreturn]]
+    static void unsupported();
+    [[nodiscard]]
+    auto typeAt(std::size_t pos) const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto check(std::size_t type) const noexcept -> bool;
+    [[nodiscard]]
+    auto checkAny(std::initializer_list<std::size_t> types) const noexcept -> bool;
+    [[nodiscard]]
+    auto isIdentifierAt(std::size_t pos) const noexcept -> bool;
+    [[nodiscard]]
+    auto isSuffixAt(std::size_t pos) const noexcept -> bool;
+    [[nodiscard]]
+    auto isAttributeDesignatorAt(std::size_t pos) const noexcept -> bool;
+    auto accept(std::size_t type) -> bool;
+    auto expect(std::size_t type) -> const antlr4::Token *;
+    auto expectIdentifier() -> const antlr4::Token *;
+    auto next() -> const antlr4::Token *;
+    [[nodiscard]]
+    auto textOf(std::size_t first, std::size_t last) const -> std::string;
+    void expectSpanEnd(std::size_t last) const;
+
+    // Lookahead used to know a node's token span before its children are parsed
+    [[nodiscard]]
+    auto matchingParen(std::size_t pos) const -> std::size_t;
+    [[nodiscard]]
+    auto findAtDepthZero(std::size_t pos, std::initializer_list<std::size_t> types) const
+      -> std::size_t;
+    [[nodiscard]]
+    auto isBlockOpener(std::size_t pos) const noexcept -> bool;
+    [[nodiscard]]
+    auto blockEnd(std::size_t opener) const -> std::size_t;
+    [[nodiscard]]
+    auto statementEnd(std::size_t pos) const -> std::size_t;
+    [[nodiscard]]
+    auto nameEnd(std::size_t pos) const -> std::size_t;
+    [[nodiscard]]
+    auto isActualPartCall(std::size_t first, std::size_t last) const -> bool;
+
+    /// @brief Parse a construct for validation only, without binding any trivia
+    template<typename Fn>
+    void validateOnly(Fn &&fn)
+    {
+        const bool saved = std::exchange(bind_, false);
+        std::invoke(std::forward<Fn>(fn));
+        bind_ = saved;
+    }
+
+    /// @brief Binds trivia for a node spanning the default tokens [first, last]
+    void bind(ast::NodeBase &node, std::size_t first, std::size_t last);
+
+    /// @brief Helper to create and bind an AST node with trivia
+    template<typename T>
+    [[nodiscard]]
+    auto make(const std::size_t first, const std::size_t last) -> T
+    {
+        T node{};
+        bind(node, first, last);
+        return node;
+    }
+
+    /// @brief Helper to create binary expressions
+    [[nodiscard]]
+    auto makeBinary(const std::size_t first,
+                    const std::size_t last,
+                    std::string op,
+                    ast::Expr left,
+                    ast::Expr right) -> ast::Expr
+    {
+        auto bin = make<ast::BinaryExpr>(first, last);
+        bin.op = std::move(op);
+        bin.left = std::make_unique<ast::Expr>(std::move(left));
+        bin.right = std::make_unique<ast::Expr>(std::move(right));
+        return bin;
+    }
+
+    /// @brief Helper to create unary expressions
+    [[nodiscard]]
+    auto makeUnary(const std::size_t first, const std::size_t last, std::string op, ast::Expr value)
+      -> ast::Expr
+    {
+        auto un = make<ast::UnaryExpr>(first, last);
+        un.op = std::move(op);
+        un.value = std::make_unique<ast::Expr>(std::move(value));
+        return un;
+    }
+
+    /// @brief Helper to create token expressions
+    [[nodiscard]]
+    auto makeToken(const std::size_t first, const std::size_t last, std::string text) -> ast::Expr
+    {
+        auto tok = make<ast::TokenExpr>(first, last);
+        tok.text = std::move(text);
+        return tok;
+    }
+};
+
+} // namespace builder
+
+#endif /* BUILDER_FAST_PARSER_HPP */
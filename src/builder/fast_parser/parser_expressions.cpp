@@ -0,0 +1,422 @@
+#include "ast/nodes/expressions.hpp"
+#include "builder/fast_parser.hpp"
+#include "vhdlParser.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace builder {
+
+// ---------------------- Operators ----------------------
+//
+// Precedence climbing over the operator levels of the grammar. A plain operand costs a single
+// parseBinary call instead of one call per grammar rule, and every operator chain is folded to
+// the left in one loop. Trivia follows the Translator: only the node that ends a chain on its
+// level is bound, spanning from the first operand of that level to the current token.
+
+auto FastParser::precedenceOf(const std::size_t type) noexcept -> Precedence
+{
+    switch (type) {
+        case vhdlParser::AND:
+        case vhdlParser::OR:
+        case vhdlParser::NAND:
+        case vhdlParser::NOR:
+        case vhdlParser::XOR:
+        case vhdlParser::XNOR:
+            return Precedence::LOGICAL;
+        case vhdlParser::EQ:
+        case vhdlParser::NEQ:
+        case vhdlParser::LOWERTHAN:
+        case vhdlParser::LE:
+        case vhdlParser::GREATERTHAN:
+        case vhdlParser::GE:
+            return Precedence::RELATIONAL;
+        case vhdlParser::SLL:
+        case vhdlParser::SRL:
+        case vhdlParser::SLA:
+        case vhdlParser::SRA:
+        case vhdlParser::ROL:
+        case vhdlParser::ROR:
+            return Precedence::SHIFT;
+        case vhdlParser::PLUS:
+        case vhdlParser::MINUS:
+        case vhdlParser::AMPERSAND:
+            return Precedence::ADDING;
+        case vhdlParser::MUL:
+        case vhdlParser::DIV:
+        case vhdlParser::MOD:
+        case vhdlParser::REM:
+            return Precedence::MULTIPLYING;
+        case vhdlParser::DOUBLESTAR:
+            return Precedence::EXPONENT;
+        default:
+            return Precedence::NONE;
+    }
+}
+
+auto FastParser::parseExpr() -> ast::Expr
+{
+    return parseBinary(Precedence::LOGICAL);
+}
+
+auto FastParser::parseSimpleExpr() -> ast::Expr
+{
+    return parseBinary(Precedence::ADDING);
+}
+
+auto FastParser::parseBinary(const Precedence min_level) -> ast::Expr
+{
+    const auto first = pos_;
+    auto left = parseOperand(min_level);
+
+    while (true) {
+        const auto level = precedenceOf(typeAt(pos_));
+        if (level == Precedence::NONE || level < min_level) {
+            return left;
+        }
+
+        ast::BinaryExpr bin{};
+        bin.op = next()->getText();
+        bin.left = std::make_unique<ast::Expr>(std::move(left));
+        bin.right = std::make_unique<ast::Expr>(
+          parseBinary(static_cast<Precedence>(std::to_underlying(level) + 1)));
+        bindChainEnd(bin, first, level);
+        left = std::move(bin);
+
+        // Relations, shifts and exponents take exactly two operands
+        const bool chains = level == Precedence::LOGICAL
+                         || level == Precedence::ADDING
+                         || level == Precedence::MULTIPLYING;
+        if (!chains && precedenceOf(typeAt(pos_)) == level) {
+            unsupported();
+        }
+    }
+}
+
+auto FastParser::parseOperand(const Precedence min_level) -> ast::Expr
+{
+    const auto first = pos_;
+
+    // A sign starts a simple expression and covers its first term
+    if (min_level <= Precedence::ADDING && checkAny({ vhdlParser::PLUS, vhdlParser::MINUS })) {
+        ast::UnaryExpr un{};
+        un.op = next()->getText();
+        un.value = std::make_unique<ast::Expr>(parseBinary(Precedence::MULTIPLYING));
+        bindChainEnd(un, first, Precedence::ADDING);
+        return un;
+    }
+
+    if (min_level <= Precedence::EXPONENT && checkAny({ vhdlParser::ABS, vhdlParser::NOT })) {
+        std::string op = check(vhdlParser::ABS) ? "abs" : "not";
+        next();
+        auto value = parsePrimary();
+        // factor: ABS primary | NOT primary, there is no exponent after them
+        if (check(vhdlParser::DOUBLESTAR)) {
+            unsupported();
+        }
+        return makeUnary(first, pos_ - 1, std::move(op), std::move(value));
+    }
+
+    return parsePrimary();
+}
+
+void FastParser::bindChainEnd(ast::NodeBase &node, const std::size_t first, const Precedence level)
+{
+    if (precedenceOf(typeAt(pos_)) != level) {
+        bind(node, first, pos_ - 1);
+    }
+}
+
+auto FastParser::parsePrimary() -> ast::Expr
+{
+    const auto first = pos_;
+
+    if (check(vhdlParser::LPAREN)) {
+        const auto last = matchingParen(first);
+        // The grammar prefers a parenthesized expression over a one-element aggregate
+        if (findAtDepthZero(first + 1, { vhdlParser::COMMA, vhdlParser::ARROW }) != last) {
+            return parseAggregate();
+        }
+
+        auto paren = make<ast::ParenExpr>(first, last);
+        expect(vhdlParser::LPAREN);
+        paren.inner = std::make_unique<ast::Expr>(parseExpr());
+        expect(vhdlParser::RPAREN);
+        return paren;
+    }
+
+    if (checkAny({ vhdlParser::INTEGER, vhdlParser::REAL_LITERAL, vhdlParser::BASE_LITERAL })) {
+        next();
+        // Physical literal: abstract_literal identifier
+        if (isIdentifierAt(pos_)) {
+            next();
+        }
+        return makeToken(first, pos_ - 1, textOf(first, pos_ - 1));
+    }
+
+    if (checkAny({ vhdlParser::BIT_STRING_LITERAL,
+                   vhdlParser::CHARACTER_LITERAL,
+                   vhdlParser::NULL_ })) {
+        next();
+        return makeToken(first, first, textOf(first, first));
+    }
+
+    if (check(vhdlParser::STRING_LITERAL)) {
+        // Operator symbols used as names are left to the ANTLR path
+        if (typeAt(first + 1) == vhdlParser::LPAREN
+            || typeAt(first + 1) == vhdlParser::DOT
+            || typeAt(first + 1) == vhdlParser::APOSTROPHE) {
+            unsupported();
+        }
+        next();
+        return makeToken(first, first, textOf(first, first));
+    }
+
+    if (isIdentifierAt(pos_)) {
+        return parseName();
+    }
+
+    unsupported();
+}
+
+// ---------------------- Names ----------------------
+
+auto FastParser::parseName() -> ast::Expr
+{
+    const auto first = pos_;
+    if (!isIdentifierAt(first)) {
+        unsupported();
+    }
+    const auto last = nameEnd(first);
+
+    // Leading selections are folded into the base, e.g. "rec.field"
+    auto base_last = first;
+    while (typeAt(base_last + 1) == vhdlParser::DOT) {
+        base_last += 2;
+    }
+
+    if (base_last == last) {
+        pos_ = last + 1;
+        return makeToken(first, last, textOf(first, last));
+    }
+
+    // The base token is bound to the whole name, like the Translator does
+    ast::Expr base = makeToken(first, last, textOf(first, base_last));
+    pos_ = base_last + 1;
+
+    while (pos_ <= last) {
+        if (check(vhdlParser::LPAREN)) {
+            const auto close = matchingParen(pos_);
+            const bool is_slice
+              = findAtDepthZero(pos_ + 1, { vhdlParser::TO, vhdlParser::DOWNTO }) != close;
+            base = is_slice ? parseSliceExpr(std::move(base)) : parseCallExpr(std::move(base));
+        } else if (check(vhdlParser::APOSTROPHE)) {
+            base = parseAttributeExpr(std::move(base));
+        } else {
+            // Selections after a call or attribute are dropped by the Translator
+            unsupported();
+        }
+    }
+
+    return base;
+}
+
+auto FastParser::parseSliceExpr(ast::Expr base) -> ast::Expr
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first);
+    auto slice_expr = make<ast::CallExpr>(first, last);
+    slice_expr.callee = std::make_unique<ast::Expr>(std::move(base));
+
+    expect(vhdlParser::LPAREN);
+    slice_expr.args = std::make_unique<ast::Expr>(parseRange());
+    expect(vhdlParser::RPAREN);
+    expectSpanEnd(last);
+
+    return slice_expr;
+}
+
+auto FastParser::parseCallExpr(ast::Expr base) -> ast::Expr
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first);
+    auto call_expr = make<ast::CallExpr>(first, last);
+    call_expr.callee = std::make_unique<ast::Expr>(std::move(base));
+
+    expect(vhdlParser::LPAREN);
+    if (findAtDepthZero(pos_, { vhdlParser::COMMA }) == last) {
+        call_expr.args = std::make_unique<ast::Expr>(parseCallArgument());
+    } else {
+        auto group = make<ast::GroupExpr>(first + 1, last - 1);
+        do {
+            group.children.push_back(parseCallArgument());
+        } while (accept(vhdlParser::COMMA));
+        call_expr.args = std::make_unique<ast::Expr>(ast::Expr{ std::move(group) });
+    }
+    expect(vhdlParser::RPAREN);
+    expectSpanEnd(last);
+
+    return call_expr;
+}
+
+auto FastParser::parseAttributeExpr(ast::Expr base) -> ast::Expr
+{
+    const auto first = pos_;
+    expect(vhdlParser::APOSTROPHE);
+    if (!isAttributeDesignatorAt(pos_)) {
+        unsupported();
+    }
+    const auto last = pos_;
+    next();
+
+    auto attribute = makeToken(first, last, textOf(last, last));
+    return makeBinary(first, last, "'", std::move(base), std::move(attribute));
+}
+
+auto FastParser::parseCallArgument() -> ast::Expr
+{
+    const auto end = findAtDepthZero(pos_, { vhdlParser::COMMA });
+
+    // Named association: only simple formals are supported
+    if (isIdentifierAt(pos_) && typeAt(pos_ + 1) == vhdlParser::ARROW) {
+        pos_ += 2;
+    } else if (findAtDepthZero(pos_, { vhdlParser::COMMA, vhdlParser::ARROW }) != end) {
+        unsupported();
+    }
+
+    const auto first = pos_;
+    if (first >= end) {
+        unsupported();
+    }
+    const auto last = end - 1;
+
+    if (check(vhdlParser::OPEN) && first == last) {
+        next();
+        return makeToken(first, last, textOf(first, last));
+    }
+
+    // actual_part prefers `name ( actual_designator )`, which the Translator keeps as text
+    if (isActualPartCall(first, last)) {
+        validateOnly([this] -> void { std::ignore = parseExpr(); });
+        expectSpanEnd(last);
+        return makeToken(first, last, textOf(first, last));
+    }
+
+    auto expr = parseExpr();
+    expectSpanEnd(last);
+    return expr;
+}
+
+auto FastParser::isActualPartCall(const std::size_t first, const std::size_t last) const -> bool
+{
+    if (typeAt(last) != vhdlParser::RPAREN || !isIdentifierAt(first)) {
+        return false;
+    }
+
+    // The argument must be a name whose final part is a parenthesized single designator
+    auto i = first + 1;
+    while (true) {
+        const auto type = typeAt(i);
+        if (type == vhdlParser::DOT && isSuffixAt(i + 1)) {
+            i += 2;
+        } else if (type == vhdlParser::APOSTROPHE && isAttributeDesignatorAt(i + 1)) {
+            i += 2;
+        } else if (type == vhdlParser::LPAREN) {
+            const auto close = matchingParen(i);
+            if (close != last) {
+                i = close + 1;
+                continue;
+            }
+            const auto separator = findAtDepthZero(i + 1,
+                                                   { vhdlParser::COMMA,
+                                                     vhdlParser::ARROW,
+                                                     vhdlParser::BAR,
+                                                     vhdlParser::TO,
+                                                     vhdlParser::DOWNTO });
+            return i + 1 < last && separator == last;
+        } else {
+            return false;
+        }
+    }
+}
+
+// ---------------------- Aggregates ----------------------
+
+auto FastParser::parseAggregate() -> ast::Expr
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first);
+    auto group = make<ast::GroupExpr>(first, last);
+
+    expect(vhdlParser::LPAREN);
+    do {
+        const auto elem_end = findAtDepthZero(pos_, { vhdlParser::COMMA });
+        auto assoc = make<ast::BinaryExpr>(pos_, elem_end - 1);
+        assoc.op = "=>";
+
+        const auto arrow = findAtDepthZero(pos_, { vhdlParser::ARROW, vhdlParser::COMMA });
+        if (typeAt(arrow) == vhdlParser::ARROW) {
+            assoc.left = std::make_unique<ast::Expr>(parseChoices());
+            expect(vhdlParser::ARROW);
+        }
+        assoc.right = std::make_unique<ast::Expr>(parseExpr());
+        expectSpanEnd(elem_end - 1);
+
+        group.children.emplace_back(std::move(assoc));
+    } while (accept(vhdlParser::COMMA));
+    expect(vhdlParser::RPAREN);
+    expectSpanEnd(last);
+
+    return group;
+}
+
+auto FastParser::parseChoices() -> ast::Expr
+{
+    const auto first = pos_;
+    const auto arrow = findAtDepthZero(first, { vhdlParser::ARROW });
+    if (findAtDepthZero(first, { vhdlParser::BAR, vhdlParser::ARROW }) == arrow) {
+        return parseChoice();
+    }
+
+    auto grp = make<ast::GroupExpr>(first, arrow - 1);
+    do {
+        grp.children.push_back(parseChoice());
+    } while (accept(vhdlParser::BAR));
+    return grp;
+}
+
+auto FastParser::parseChoice() -> ast::Expr
+{
+    const auto first = pos_;
+
+    if (accept(vhdlParser::OTHERS)) {
+        return makeToken(first, first, "others");
+    }
+
+    // A lone identifier is matched by the first choice alternative
+    const auto follow = typeAt(first + 1);
+    if (isIdentifierAt(first) && (follow == vhdlParser::BAR || follow == vhdlParser::ARROW)) {
+        next();
+        return makeToken(first, first, textOf(first, first));
+    }
+
+    return parseRange();
+}
+
+auto FastParser::parseRange() -> ast::Expr
+{
+    const auto first = pos_;
+    auto left = parseSimpleExpr();
+    if (!checkAny({ vhdlParser::TO, vhdlParser::DOWNTO })) {
+        return left;
+    }
+
+    auto op = next()->getText();
+    auto right = parseSimpleExpr();
+    return makeBinary(first, pos_ - 1, std::move(op), std::move(left), std::move(right));
+}
+
+} // namespace builder
@@ -0,0 +1,441 @@
+#include "ast/nodes/expressions.hpp"
+#include "ast/nodes/statements.hpp"
+#include "builder/fast_parser.hpp"
+#include "vhdlParser.h"
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace builder {
+
+// ---------------------- Concurrent statements ----------------------
+
+auto FastParser::parseConcurrentStatement() -> ast::ConcurrentStatement
+{
+    const bool has_label = isIdentifierAt(pos_) && typeAt(pos_ + 1) == vhdlParser::COLON;
+    if (has_label || checkAny({ vhdlParser::POSTPONED, vhdlParser::PROCESS })) {
+        return parseProcess();
+    }
+    return parseConcurrentAssign();
+}
+
+auto FastParser::parseConcurrentAssign() -> ast::ConcurrentAssign
+{
+    const auto first = pos_;
+    const auto last = statementEnd(first);
+    auto assign = make<ast::ConcurrentAssign>(first, last);
+
+    assign.target = parseTarget();
+    expect(vhdlParser::LE);
+    accept(vhdlParser::GUARDED);
+    parseDelayMechanism();
+    assign.value = parseWaveformValue();
+
+    // Only the first waveform is translated, the remaining alternatives are validated
+    while (accept(vhdlParser::WHEN)) {
+        validateOnly([this] -> void { std::ignore = parseExpr(); });
+        if (!accept(vhdlParser::ELSE)) {
+            break;
+        }
+        validateOnly([this] -> void { std::ignore = parseWaveformValue(); });
+    }
+
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return assign;
+}
+
+auto FastParser::parseProcess() -> ast::Process
+{
+    const auto first = pos_;
+
+    std::optional<std::string> label;
+    if (isIdentifierAt(pos_) && typeAt(pos_ + 1) == vhdlParser::COLON) {
+        label = next()->getText();
+        expect(vhdlParser::COLON);
+    }
+    accept(vhdlParser::POSTPONED);
+    if (!check(vhdlParser::PROCESS)) {
+        unsupported();
+    }
+
+    const auto last = blockEnd(pos_);
+    auto proc = make<ast::Process>(first, last);
+    proc.label = std::move(label);
+
+    expect(vhdlParser::PROCESS);
+    if (accept(vhdlParser::LPAREN)) {
+        do {
+            proc.sensitivity_list.push_back(parseSensitivityName());
+        } while (accept(vhdlParser::COMMA));
+        expect(vhdlParser::RPAREN);
+    }
+    accept(vhdlParser::IS);
+
+    parseProcessDeclarativePart();
+    expect(vhdlParser::BEGIN);
+
+    while (!check(vhdlParser::END)) {
+        proc.body.push_back(parseSequentialStatement());
+    }
+
+    expect(vhdlParser::END);
+    accept(vhdlParser::POSTPONED);
+    expect(vhdlParser::PROCESS);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return proc;
+}
+
+auto FastParser::parseSensitivityName() -> std::string
+{
+    const auto first = pos_;
+    validateOnly([this] -> void { std::ignore = parseName(); });
+    return textOf(first, pos_ - 1);
+}
+
+void FastParser::parseProcessDeclarativePart()
+{
+    // Process declarations are not translated, they are only validated
+    validateOnly([this] -> void {
+        while (!check(vhdlParser::BEGIN)) {
+            if (check(vhdlParser::CONSTANT)) {
+                std::ignore = parseConstantDecl();
+                continue;
+            }
+
+            expect(vhdlParser::VARIABLE);
+            std::ignore = parseIdentifierList();
+            expect(vhdlParser::COLON);
+            std::ignore = parseTypeMark();
+            if (checkAny({ vhdlParser::RANGE, vhdlParser::LPAREN })) {
+                std::ignore = parseConstraint();
+            }
+            if (accept(vhdlParser::VARASGN)) {
+                std::ignore = parseExpr();
+            }
+            expect(vhdlParser::SEMI);
+        }
+    });
+}
+
+// ---------------------- Sequential statements ----------------------
+
+auto FastParser::parseSequentialStatement() -> ast::SequentialStatement
+{
+    if (check(vhdlParser::IF)) {
+        return parseIfStatement();
+    }
+    if (check(vhdlParser::CASE)) {
+        return parseCaseStatement();
+    }
+    if (check(vhdlParser::FOR)) {
+        return parseForLoop();
+    }
+    if (check(vhdlParser::WHILE)) {
+        return parseWhileLoop();
+    }
+    if (checkAny({ vhdlParser::WAIT,
+                   vhdlParser::ASSERT,
+                   vhdlParser::REPORT,
+                   vhdlParser::NEXT,
+                   vhdlParser::EXIT,
+                   vhdlParser::NULL_,
+                   vhdlParser::LOOP })) {
+        return parseUntranslatedStatement();
+    }
+
+    // Labelled statements are not supported
+    if (isIdentifierAt(pos_) && typeAt(pos_ + 1) == vhdlParser::COLON) {
+        unsupported();
+    }
+    if (!isIdentifierAt(pos_) && !check(vhdlParser::LPAREN)) {
+        unsupported();
+    }
+
+    const auto kind
+      = typeAt(findAtDepthZero(pos_, { vhdlParser::LE, vhdlParser::VARASGN, vhdlParser::SEMI }));
+    if (kind == vhdlParser::LE) {
+        return parseSequentialAssign();
+    }
+    if (kind == vhdlParser::VARASGN) {
+        return parseVariableAssign();
+    }
+    if (kind == vhdlParser::SEMI) {
+        return parseUntranslatedStatement();
+    }
+    unsupported();
+}
+
+auto FastParser::parseSequenceOfStatements() -> std::vector<ast::SequentialStatement>
+{
+    std::vector<ast::SequentialStatement> statements;
+
+    while (!checkAny({ vhdlParser::END, vhdlParser::ELSIF, vhdlParser::ELSE, vhdlParser::WHEN })) {
+        statements.emplace_back(parseSequentialStatement());
+    }
+
+    return statements;
+}
+
+auto FastParser::parseUntranslatedStatement() -> ast::SequentialStatement
+{
+    // The Translator emits an empty placeholder for these statements, so they are only
+    // validated and nothing inside them is bound.
+    validateOnly([this] -> void {
+        if (accept(vhdlParser::NULL_)) {
+            // null;
+        } else if (accept(vhdlParser::WAIT)) {
+            if (accept(vhdlParser::ON)) {
+                do {
+                    std::ignore = parseSensitivityName();
+                } while (accept(vhdlParser::COMMA));
+            }
+            if (accept(vhdlParser::UNTIL)) {
+                std::ignore = parseExpr();
+            }
+            if (accept(vhdlParser::FOR)) {
+                std::ignore = parseExpr();
+            }
+        } else if (accept(vhdlParser::ASSERT)) {
+            std::ignore = parseExpr();
+            if (accept(vhdlParser::REPORT)) {
+                std::ignore = parseExpr();
+            }
+            if (accept(vhdlParser::SEVERITY)) {
+                std::ignore = parseExpr();
+            }
+        } else if (accept(vhdlParser::REPORT)) {
+            std::ignore = parseExpr();
+            if (accept(vhdlParser::SEVERITY)) {
+                std::ignore = parseExpr();
+            }
+        } else if (accept(vhdlParser::NEXT) || accept(vhdlParser::EXIT)) {
+            if (isIdentifierAt(pos_)) {
+                next();
+            }
+            if (accept(vhdlParser::WHEN)) {
+                std::ignore = parseExpr();
+            }
+        } else if (accept(vhdlParser::LOOP)) {
+            std::ignore = parseSequenceOfStatements();
+            expect(vhdlParser::END);
+            expect(vhdlParser::LOOP);
+            if (isIdentifierAt(pos_)) {
+                next();
+            }
+        } else {
+            // Procedure call: selected_name (LPAREN actual_parameter_part RPAREN)?
+            std::ignore = parseSelectedName();
+            if (accept(vhdlParser::LPAREN)) {
+                do {
+                    std::ignore = parseCallArgument();
+                } while (accept(vhdlParser::COMMA));
+                expect(vhdlParser::RPAREN);
+            }
+        }
+        expect(vhdlParser::SEMI);
+    });
+
+    return ast::SequentialAssign{};
+}
+
+auto FastParser::parseTarget() -> ast::Expr
+{
+    if (check(vhdlParser::LPAREN)) {
+        return parseAggregate();
+    }
+    return parseName();
+}
+
+auto FastParser::parseSequentialAssign() -> ast::SequentialAssign
+{
+    const auto first = pos_;
+    const auto last = statementEnd(first);
+    auto assign = make<ast::SequentialAssign>(first, last);
+
+    assign.target = parseTarget();
+    expect(vhdlParser::LE);
+    parseDelayMechanism();
+    assign.value = parseWaveformValue();
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return assign;
+}
+
+auto FastParser::parseVariableAssign() -> ast::SequentialAssign
+{
+    const auto first = pos_;
+    const auto last = statementEnd(first);
+    auto assign = make<ast::SequentialAssign>(first, last);
+
+    assign.target = parseTarget();
+    expect(vhdlParser::VARASGN);
+    assign.value = parseExpr();
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return assign;
+}
+
+auto FastParser::parseWaveformValue() -> ast::Expr
+{
+    if (accept(vhdlParser::UNAFFECTED)) {
+        return ast::Expr{};
+    }
+
+    // Only the first waveform element is translated
+    auto value = parseExpr();
+    validateOnly([this] -> void {
+        if (accept(vhdlParser::AFTER)) {
+            std::ignore = parseExpr();
+        }
+        while (accept(vhdlParser::COMMA)) {
+            std::ignore = parseExpr();
+            if (accept(vhdlParser::AFTER)) {
+                std::ignore = parseExpr();
+            }
+        }
+    });
+    return value;
+}
+
+void FastParser::parseDelayMechanism()
+{
+    if (accept(vhdlParser::TRANSPORT)) {
+        return;
+    }
+    if (accept(vhdlParser::REJECT)) {
+        validateOnly([this] -> void { std::ignore = parseExpr(); });
+        expect(vhdlParser::INERTIAL);
+        return;
+    }
+    accept(vhdlParser::INERTIAL);
+}
+
+// ---------------------- Control flow ----------------------
+
+auto FastParser::parseIfStatement() -> ast::IfStatement
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto stmt = make<ast::IfStatement>(first, last);
+
+    expect(vhdlParser::IF);
+    stmt.if_branch.condition = parseExpr();
+    expect(vhdlParser::THEN);
+    stmt.if_branch.body = parseSequenceOfStatements();
+
+    while (accept(vhdlParser::ELSIF)) {
+        ast::IfStatement::Branch elsif_branch;
+        elsif_branch.condition = parseExpr();
+        expect(vhdlParser::THEN);
+        elsif_branch.body = parseSequenceOfStatements();
+        stmt.elsif_branches.push_back(std::move(elsif_branch));
+    }
+
+    if (accept(vhdlParser::ELSE)) {
+        ast::IfStatement::Branch else_branch;
+        else_branch.body = parseSequenceOfStatements();
+        stmt.else_branch = std::move(else_branch);
+    }
+
+    expect(vhdlParser::END);
+    expect(vhdlParser::IF);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return stmt;
+}
+
+auto FastParser::parseCaseStatement() -> ast::CaseStatement
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto stmt = make<ast::CaseStatement>(first, last);
+
+    expect(vhdlParser::CASE);
+    stmt.selector = parseExpr();
+    expect(vhdlParser::IS);
+
+    do {
+        expect(vhdlParser::WHEN);
+        ast::CaseStatement::WhenClause when_clause;
+        do {
+            when_clause.choices.push_back(parseChoice());
+        } while (accept(vhdlParser::BAR));
+        expect(vhdlParser::ARROW);
+        when_clause.body = parseSequenceOfStatements();
+        stmt.when_clauses.push_back(std::move(when_clause));
+    } while (check(vhdlParser::WHEN));
+
+    expect(vhdlParser::END);
+    expect(vhdlParser::CASE);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return stmt;
+}
+
+auto FastParser::parseForLoop() -> ast::ForLoop
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto loop = make<ast::ForLoop>(first, last);
+
+    expect(vhdlParser::FOR);
+    loop.iterator = expectIdentifier()->getText();
+    expect(vhdlParser::IN);
+    loop.range = parseRange();
+    expect(vhdlParser::LOOP);
+    loop.body = parseSequenceOfStatements();
+
+    expect(vhdlParser::END);
+    expect(vhdlParser::LOOP);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return loop;
+}
+
+auto FastParser::parseWhileLoop() -> ast::WhileLoop
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto loop = make<ast::WhileLoop>(first, last);
+
+    expect(vhdlParser::WHILE);
+    loop.condition = parseExpr();
+    expect(vhdlParser::LOOP);
+    loop.body = parseSequenceOfStatements();
+
+    expect(vhdlParser::END);
+    expect(vhdlParser::LOOP);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return loop;
+}
+
+} // namespace builder
@@ -0,0 +1,615 @@
+#include "builder/fast_parser.hpp"
+
+#include "CommonTokenStream.h"
+#include "Token.h"
+#include "ast/nodes/declarations.hpp"
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "ast/nodes/expressions.hpp"
+#include "vhdlParser.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace builder {
+
+FastParser::FastParser(antlr4::CommonTokenStream &tokens) : FastParser(tokens, nullptr) {}
+
+FastParser::FastParser(antlr4::CommonTokenStream &tokens, common::PipelineStats *stats) :
+  trivia_(tokens, stats)
+{
+    tokens_ = tokens.getTokens()
+            | std::views::filter([](const antlr4::Token *token) -> bool {
+                  return token->getChannel() == antlr4::Token::DEFAULT_CHANNEL;
+              })
+            | std::ranges::to<std::vector>();
+}
+
+// ---------------------- Token access ----------------------
+
+void FastParser::unsupported()
+{
+    throw Unsupported{};
+}
+
+auto FastParser::typeAt(const std::size_t pos) const noexcept -> std::size_t
+{
+    if (tokens_.empty()) {
+        return antlr4::Token::EOF;
+    }
+    return tokens_[std::min(pos, tokens_.size() - 1)]->getType();
+}
+
+auto FastParser::check(const std::size_t type) const noexcept -> bool
+{
+    return typeAt(pos_) == type;
+}
+
+auto FastParser::checkAny(const std::initializer_list<std::size_t> types) const noexcept -> bool
+{
+    return std::ranges::contains(types, typeAt(pos_));
+}
+
+auto FastParser::isIdentifierAt(const std::size_t pos) const noexcept -> bool
+{
+    const auto type = typeAt(pos);
+    return type == vhdlParser::BASIC_IDENTIFIER || type == vhdlParser::EXTENDED_IDENTIFIER;
+}
+
+auto FastParser::isSuffixAt(const std::size_t pos) const noexcept -> bool
+{
+    const auto type = typeAt(pos);
+    return isIdentifierAt(pos)
+        || type == vhdlParser::CHARACTER_LITERAL
+        || type == vhdlParser::STRING_LITERAL
+        || type == vhdlParser::ALL;
+}
+
+auto FastParser::isAttributeDesignatorAt(const std::size_t pos) const noexcept -> bool
+{
+    const auto type = typeAt(pos);
+    return isIdentifierAt(pos)
+        || type == vhdlParser::RANGE
+        || type == vhdlParser::REVERSE_RANGE
+        || type == vhdlParser::ACROSS
+        || type == vhdlParser::THROUGH
+        || type == vhdlParser::REFERENCE
+        || type == vhdlParser::TOLERANCE;
+}
+
+auto FastParser::accept(const std::size_t type) -> bool
+{
+    if (!check(type)) {
+        return false;
+    }
+    ++pos_;
+    return true;
+}
+
+auto FastParser::expect(const std::size_t type) -> const antlr4::Token *
+{
+    if (!check(type)) {
+        unsupported();
+    }
+    return tokens_[pos_++];
+}
+
+auto FastParser::expectIdentifier() -> const antlr4::Token *
+{
+    if (!isIdentifierAt(pos_)) {
+        unsupported();
+    }
+    return tokens_[pos_++];
+}
+
+auto FastParser::next() -> const antlr4::Token *
+{
+    if (check(antlr4::Token::EOF)) {
+        unsupported();
+    }
+    return tokens_[pos_++];
+}
+
+auto FastParser::textOf(const std::size_t first, const std::size_t last) const -> std::string
+{
+    // Same as ParserRuleContext::getText(): default tokens concatenated without separators
+    std::string text;
+    for (const auto *token : std::span(tokens_).subspan(first, last - first + 1)) {
+        text += token->getText();
+    }
+    return text;
+}
+
+void FastParser::expectSpanEnd(const std::size_t last) const
+{
+    // The span was predicted before parsing the node; a mismatch means the lookahead
+    // disagrees with the grammar and the node was bound to the wrong tokens.
+    if (pos_ != last + 1) {
+        unsupported();
+    }
+}
+
+void FastParser::bind(ast::NodeBase &node, const std::size_t first, const std::size_t last)
+{
+    if (last < first) {
+        unsupported();
+    }
+    if (!bind_) {
+        return;
+    }
+    trivia_.bind(node, tokens_[first]->getTokenIndex(), tokens_[last]->getTokenIndex());
+}
+
+// ---------------------- Lookahead ----------------------
+
+auto FastParser::matchingParen(const std::size_t pos) const -> std::size_t
+{
+    if (typeAt(pos) != vhdlParser::LPAREN) {
+        unsupported();
+    }
+
+    std::size_t depth{ 0 };
+    for (auto i = pos; typeAt(i) != antlr4::Token::EOF; ++i) {
+        if (typeAt(i) == vhdlParser::LPAREN) {
+            ++depth;
+        } else if (typeAt(i) == vhdlParser::RPAREN && --depth == 0) {
+            return i;
+        }
+    }
+    unsupported();
+}
+
+auto FastParser::findAtDepthZero(const std::size_t pos,
+                                 const std::initializer_list<std::size_t> types) const
+  -> std::size_t
+{
+    std::size_t depth{ 0 };
+    for (auto i = pos;; ++i) {
+        const auto type = typeAt(i);
+        if (type == antlr4::Token::EOF) {
+            return i;
+        }
+        if (depth == 0 && std::ranges::contains(types, type)) {
+            return i;
+        }
+        if (type == vhdlParser::LPAREN) {
+            ++depth;
+        } else if (type == vhdlParser::RPAREN) {
+            // Unbalanced parenthesis closes the enclosing list
+            if (depth == 0) {
+                return i;
+            }
+            --depth;
+        }
+    }
+}
+
+auto FastParser::isBlockOpener(const std::size_t pos) const noexcept -> bool
+{
+    const auto type = typeAt(pos);
+    const bool opener = type == vhdlParser::ENTITY
+                     || type == vhdlParser::ARCHITECTURE
+                     || type == vhdlParser::PROCESS
+                     || type == vhdlParser::IF
+                     || type == vhdlParser::CASE
+                     || type == vhdlParser::LOOP;
+    if (!opener || pos == 0) {
+        return opener;
+    }
+
+    // Closing keywords repeat the opener: END IF, END LOOP, END POSTPONED PROCESS, ...
+    if (typeAt(pos - 1) == vhdlParser::END) {
+        return false;
+    }
+    return !(type == vhdlParser::PROCESS
+             && typeAt(pos - 1) == vhdlParser::POSTPONED
+             && pos >= 2
+             && typeAt(pos - 2) == vhdlParser::END);
+}
+
+auto FastParser::blockEnd(const std::size_t opener) const -> std::size_t
+{
+    std::size_t depth{ 0 };
+    for (auto i = opener; typeAt(i) != antlr4::Token::EOF; ++i) {
+        if (isBlockOpener(i)) {
+            ++depth;
+        } else if (typeAt(i) == vhdlParser::END) {
+            if (depth == 0) {
+                unsupported();
+            }
+            if (--depth == 0) {
+                return statementEnd(i);
+            }
+        }
+    }
+    unsupported();
+}
+
+auto FastParser::statementEnd(const std::size_t pos) const -> std::size_t
+{
+    const auto end = findAtDepthZero(pos, { vhdlParser::SEMI });
+    if (typeAt(end) != vhdlParser::SEMI) {
+        unsupported();
+    }
+    return end;
+}
+
+auto FastParser::nameEnd(const std::size_t pos) const -> std::size_t
+{
+    auto i = pos + 1;
+    while (true) {
+        const auto type = typeAt(i);
+        if (type == vhdlParser::DOT) {
+            if (!isSuffixAt(i + 1)) {
+                unsupported();
+            }
+            i += 2;
+        } else if (type == vhdlParser::LPAREN) {
+            i = matchingParen(i) + 1;
+        } else if (type == vhdlParser::APOSTROPHE) {
+            // Qualified expressions and parameterized attributes are not supported
+            if (!isAttributeDesignatorAt(i + 1) || typeAt(i + 2) == vhdlParser::LPAREN) {
+                unsupported();
+            }
+            i += 2;
+        } else {
+            return i - 1;
+        }
+    }
+}
+
+// ---------------------- Top-level ----------------------
+
+auto FastParser::parseDesignFile() -> std::optional<ast::DesignFile>
+{
+    try {
+        ast::DesignFile root{};
+
+        while (!check(antlr4::Token::EOF)) {
+            parseContextClause();
+
+            if (check(vhdlParser::ENTITY)) {
+                root.units.emplace_back(parseEntity());
+            } else if (check(vhdlParser::ARCHITECTURE)) {
+                root.units.emplace_back(parseArchitecture());
+            } else {
+                unsupported();
+            }
+        }
+
+        return root;
+    } catch (const Unsupported &) {
+        return std::nullopt;
+    }
+}
+
+void FastParser::parseContextClause()
+{
+    // Context items are not translated, they only need to be skipped
+    while (true) {
+        if (accept(vhdlParser::LIBRARY)) {
+            std::ignore = parseIdentifierList();
+            expect(vhdlParser::SEMI);
+        } else if (accept(vhdlParser::USE)) {
+            do {
+                std::ignore = parseSelectedName();
+            } while (accept(vhdlParser::COMMA));
+            expect(vhdlParser::SEMI);
+        } else {
+            return;
+        }
+    }
+}
+
+// ---------------------- Design units ----------------------
+
+auto FastParser::parseEntity() -> ast::Entity
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto entity = make<ast::Entity>(first, last);
+
+    expect(vhdlParser::ENTITY);
+    entity.name = expectIdentifier()->getText();
+    expect(vhdlParser::IS);
+
+    if (check(vhdlParser::GENERIC)) {
+        entity.generic_clause = parseGenericClause();
+    }
+    if (check(vhdlParser::PORT)) {
+        entity.port_clause = parsePortClause();
+    }
+
+    // Entity declarative and statement parts are not supported
+    expect(vhdlParser::END);
+    accept(vhdlParser::ENTITY);
+    if (isIdentifierAt(pos_)) {
+        entity.end_label = next()->getText();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return entity;
+}
+
+auto FastParser::parseArchitecture() -> ast::Architecture
+{
+    const auto first = pos_;
+    const auto last = blockEnd(first);
+    auto arch = make<ast::Architecture>(first, last);
+
+    expect(vhdlParser::ARCHITECTURE);
+    arch.name = expectIdentifier()->getText();
+    expect(vhdlParser::OF);
+    arch.entity_name = expectIdentifier()->getText();
+    expect(vhdlParser::IS);
+
+    while (!check(vhdlParser::BEGIN)) {
+        if (check(vhdlParser::CONSTANT)) {
+            arch.decls.emplace_back(parseConstantDecl());
+        } else if (check(vhdlParser::SIGNAL)) {
+            arch.decls.emplace_back(parseSignalDecl());
+        } else {
+            unsupported();
+        }
+    }
+    expect(vhdlParser::BEGIN);
+
+    while (!check(vhdlParser::END)) {
+        arch.stmts.emplace_back(parseConcurrentStatement());
+    }
+
+    expect(vhdlParser::END);
+    accept(vhdlParser::ARCHITECTURE);
+    if (isIdentifierAt(pos_)) {
+        next();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return arch;
+}
+
+// ---------------------- Clauses ----------------------
+
+auto FastParser::parseGenericClause() -> ast::GenericClause
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first + 1) + 1;
+    auto clause = make<ast::GenericClause>(first, last);
+
+    expect(vhdlParser::GENERIC);
+    expect(vhdlParser::LPAREN);
+    do {
+        clause.generics.push_back(parseGenericParam());
+    } while (accept(vhdlParser::SEMI));
+    clause.generics.back().is_last = true;
+    expect(vhdlParser::RPAREN);
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return clause;
+}
+
+auto FastParser::parsePortClause() -> ast::PortClause
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first + 1) + 1;
+    auto clause = make<ast::PortClause>(first, last);
+
+    expect(vhdlParser::PORT);
+    expect(vhdlParser::LPAREN);
+    do {
+        clause.ports.push_back(parseSignalPort());
+    } while (accept(vhdlParser::SEMI));
+    clause.ports.back().is_last = true;
+    expect(vhdlParser::RPAREN);
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return clause;
+}
+
+// ---------------------- Interface declarations ----------------------
+
+auto FastParser::parseGenericParam() -> ast::GenericParam
+{
+    const auto first = pos_;
+    const auto last = findAtDepthZero(first, { vhdlParser::SEMI }) - 1;
+    auto param = make<ast::GenericParam>(first, last);
+
+    accept(vhdlParser::CONSTANT);
+    param.names = parseIdentifierList();
+    expect(vhdlParser::COLON);
+    accept(vhdlParser::IN);
+
+    // The whole subtype indication is kept as text
+    const auto type_first = pos_;
+    validateOnly([this] -> void {
+        std::ignore = parseTypeMark();
+        if (checkAny({ vhdlParser::RANGE, vhdlParser::LPAREN })) {
+            std::ignore = parseConstraint();
+        }
+    });
+    param.type_name = textOf(type_first, pos_ - 1);
+
+    if (accept(vhdlParser::VARASGN)) {
+        param.default_expr = parseExpr();
+    }
+    expectSpanEnd(last);
+
+    return param;
+}
+
+auto FastParser::parseSignalPort() -> ast::Port
+{
+    const auto first = pos_;
+    const auto last = findAtDepthZero(first, { vhdlParser::SEMI }) - 1;
+    auto port = make<ast::Port>(first, last);
+
+    port.names = parseIdentifierList();
+    expect(vhdlParser::COLON);
+
+    if (checkAny({ vhdlParser::IN,
+                   vhdlParser::OUT,
+                   vhdlParser::INOUT,
+                   vhdlParser::BUFFER,
+                   vhdlParser::LINKAGE })) {
+        port.mode = next()->getText();
+    }
+
+    port.type_name = parseTypeMark();
+    if (checkAny({ vhdlParser::RANGE, vhdlParser::LPAREN })) {
+        port.constraint = parseConstraint();
+    }
+    accept(vhdlParser::BUS);
+
+    if (accept(vhdlParser::VARASGN)) {
+        port.default_expr = parseExpr();
+    }
+    expectSpanEnd(last);
+
+    return port;
+}
+
+auto FastParser::parseIdentifierList() -> std::vector<ast::Symbol>
+{
+    std::vector<ast::Symbol> names;
+    do {
+        names.push_back(expectIdentifier()->getText());
+    } while (accept(vhdlParser::COMMA));
+    return names;
+}
+
+auto FastParser::parseSelectedName() -> std::string
+{
+    const auto first = pos_;
+    expectIdentifier();
+    while (check(vhdlParser::DOT)) {
+        if (!isSuffixAt(pos_ + 1)) {
+            unsupported();
+        }
+        pos_ += 2;
+    }
+    return textOf(first, pos_ - 1);
+}
+
+auto FastParser::parseTypeMark() -> std::string
+{
+    auto type_name = parseSelectedName();
+
+    // A second name means a resolution function, which the Translator does not model
+    if (isIdentifierAt(pos_)) {
+        unsupported();
+    }
+    return type_name;
+}
+
+// ---------------------- Object declarations ----------------------
+
+auto FastParser::parseConstantDecl() -> ast::ConstantDecl
+{
+    const auto first = pos_;
+    const auto last = statementEnd(first);
+    auto decl = make<ast::ConstantDecl>(first, last);
+
+    expect(vhdlParser::CONSTANT);
+    decl.names = parseIdentifierList();
+    expect(vhdlParser::COLON);
+    decl.type_name = parseTypeMark();
+
+    // Constant constraints are not translated
+    if (checkAny({ vhdlParser::RANGE, vhdlParser::LPAREN })) {
+        validateOnly([this] -> void { std::ignore = parseConstraint(); });
+    }
+
+    if (accept(vhdlParser::VARASGN)) {
+        decl.init_expr = parseExpr();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return decl;
+}
+
+auto FastParser::parseSignalDecl() -> ast::SignalDecl
+{
+    const auto first = pos_;
+    const auto last = statementEnd(first);
+    auto decl = make<ast::SignalDecl>(first, last);
+
+    expect(vhdlParser::SIGNAL);
+    decl.names = parseIdentifierList();
+    expect(vhdlParser::COLON);
+    decl.type_name = parseTypeMark();
+
+    if (checkAny({ vhdlParser::RANGE, vhdlParser::LPAREN })) {
+        decl.constraint = parseConstraint();
+    }
+
+    decl.has_bus_kw = false;
+    if (checkAny({ vhdlParser::REGISTER, vhdlParser::BUS })) {
+        decl.has_bus_kw = next()->getType() == vhdlParser::BUS;
+    }
+
+    if (accept(vhdlParser::VARASGN)) {
+        decl.init_expr = parseExpr();
+    }
+    expect(vhdlParser::SEMI);
+    expectSpanEnd(last);
+
+    return decl;
+}
+
+// ---------------------- Constraints ----------------------
+
+auto FastParser::parseConstraint() -> std::optional<ast::Constraint>
+{
+    if (check(vhdlParser::LPAREN)) {
+        return parseIndexConstraint();
+    }
+    return parseRangeConstraint();
+}
+
+auto FastParser::parseIndexConstraint() -> ast::IndexConstraint
+{
+    const auto first = pos_;
+    const auto last = matchingParen(first);
+    auto constraint = make<ast::IndexConstraint>(first, last);
+    auto group = make<ast::GroupExpr>(first, last);
+
+    expect(vhdlParser::LPAREN);
+    do {
+        group.children.push_back(parseRange());
+    } while (accept(vhdlParser::COMMA));
+    expect(vhdlParser::RPAREN);
+
+    constraint.ranges = std::move(group);
+    return constraint;
+}
+
+auto FastParser::parseRangeConstraint() -> std::optional<ast::RangeConstraint>
+{
+    const auto first = pos_;
+    expect(vhdlParser::RANGE);
+
+    auto range_expr = parseRange();
+    auto *bin = std::get_if<ast::BinaryExpr>(&range_expr);
+    if (bin == nullptr) {
+        return std::nullopt;
+    }
+    auto constraint = make<ast::RangeConstraint>(first, pos_ - 1);
+    constraint.range = std::move(*bin);
+    return constraint;
+}
+
+} // namespace builder
@@ -0,0 +1,93 @@
+#include "builder/parser_profile.hpp"
+
+#include <algorithm>
+#include <antlr4-runtime/Parser.h>
+#include <antlr4-runtime/atn/ATN.h>
+#include <antlr4-runtime/atn/DecisionInfo.h>
+#include <antlr4-runtime/atn/DecisionState.h>
+#include <antlr4-runtime/atn/ParserATNSimulator.h>
+#include <antlr4-runtime/atn/ProfilingATNSimulator.h>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <string>
+
+namespace builder {
+
+namespace {
+
+constexpr double NS_PER_MS{ 1'000'000.0 };
+
+} // namespace
+
+auto collectProfile(const antlr4::Parser &parser) -> ParserProfile
+{
+    ParserProfile profile{};
+
+    const auto *simulator = parser.getInterpreter<antlr4::atn::ProfilingATNSimulator>();
+    if (simulator == nullptr) {
+        return profile;
+    }
+
+    const auto &atn = parser.getATN();
+    const auto &rule_names = parser.getRuleNames();
+
+    for (const auto &info : simulator->getDecisionInfo()) {
+        if (info.invocations == 0) {
+            continue;
+        }
+
+        const auto total_lookahead = info.SLL_TotalLook + info.LL_TotalLook;
+        profile.decisions.push_back(DecisionProfile{
+          .decision = info.decision,
+          .rule = rule_names.at(atn.getDecisionState(info.decision)->ruleIndex),
+          .invocations = info.invocations,
+          .time_ns = info.timeInPrediction,
+          .ll_fallbacks = info.LL_Fallback,
+          .sll_max_lookahead = info.SLL_MaxLook,
+          .ll_max_lookahead = info.LL_MaxLook,
+          .mean_lookahead
+          = static_cast<double>(total_lookahead) / static_cast<double>(info.invocations),
+          .ambiguities = info.ambiguities.size(),
+          .context_sensitivities = info.contextSensitivities.size(),
+        });
+    }
+
+    std::ranges::sort(profile.decisions, std::ranges::greater{}, &DecisionProfile::time_ns);
+    return profile;
+}
+
+auto formatProfile(const ParserProfile &profile) -> std::string
+{
+    std::string out = std::format(
+      "{:<40} {:>8} {:>12} {:>10} {:>9} {:>8} {:>8} {:>8} {:>6} {:>8}\n",
+      "rule",
+      "decision",
+      "invocations",
+      "time (ms)",
+      "fallback",
+      "max SLL",
+      "max LL",
+      "mean k",
+      "ambig",
+      "ctx sens");
+
+    for (const auto &entry : profile.decisions) {
+        out += std::format(
+          "{:<40} {:>8} {:>12} {:>10.3f} {:>9} {:>8} {:>8} {:>8.2f} {:>6} {:>8}\n",
+          entry.rule,
+          entry.decision,
+          entry.invocations,
+          static_cast<double>(entry.time_ns) / NS_PER_MS,
+          entry.ll_fallbacks,
+          entry.sll_max_lookahead,
+          entry.ll_max_lookahead,
+          entry.mean_lookahead,
+          entry.ambiguities,
+          entry.context_sensitivities);
+    }
+
+    return out;
+}
+
+} // namespace builder
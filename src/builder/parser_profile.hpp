@@ -0,0 +1,48 @@
+#ifndef BUILDER_PARSER_PROFILE_HPP
+#define BUILDER_PARSER_PROFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace antlr4 {
+class Parser;
+} // namespace antlr4
+
+namespace builder {
+
+/// @brief Prediction statistics for a single decision point of the grammar
+struct DecisionProfile final
+{
+    std::size_t decision{};
+    std::string rule;                    ///< Grammar rule containing the decision
+    std::int64_t invocations{};          ///< Number of predictions made
+    std::int64_t time_ns{};              ///< Total time spent in prediction
+    std::int64_t ll_fallbacks{};         ///< Predictions that SLL could not resolve
+    std::int64_t sll_max_lookahead{};    ///< Deepest SLL lookahead in tokens
+    std::int64_t ll_max_lookahead{};     ///< Deepest LL lookahead in tokens
+    double mean_lookahead{};             ///< Average lookahead over all predictions
+    std::size_t ambiguities{};           ///< Reported ambiguities
+    std::size_t context_sensitivities{}; ///< Conflicts that full context resolved
+};
+
+/// @brief Per-decision statistics collected by ANTLR's ProfilingATNSimulator
+struct ParserProfile final
+{
+    std::vector<DecisionProfile> decisions; ///< Invoked decisions, slowest first
+};
+
+/// @brief Read the statistics of a parser that was run with profiling enabled
+/// @param parser Parser whose interpreter is a ProfilingATNSimulator
+/// @return Statistics of every invoked decision, or an empty profile if not profiling
+[[nodiscard]]
+auto collectProfile(const antlr4::Parser &parser) -> ParserProfile;
+
+/// @brief Render the profile as a plain text table
+[[nodiscard]]
+auto formatProfile(const ParserProfile &profile) -> std::string;
+
+} // namespace builder
+
+#endif /* BUILDER_PARSER_PROFILE_HPP */
@@ -10,12 +10,17 @@
 #include "vhdlParser.h"
 
 #include <CommonTokenStream.h>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+namespace common {
+struct PipelineStats;
+} // namespace common
+
 namespace builder {
 
 class Translator final
@@ -26,9 +31,22 @@ class Translator final
   public:
     explicit Translator(antlr4::CommonTokenStream &tokens) : trivia_(tokens), tokens_(tokens) {}
 
+    /// @brief Translator whose bound nodes are counted into `stats`, if not null
+    Translator(antlr4::CommonTokenStream &tokens, common::PipelineStats *stats) :
+      trivia_(tokens, stats),
+      tokens_(tokens)
+    {
+    }
+
     /// @brief Build the entire design file by walking the CST
     void buildDesignFile(ast::DesignFile &dest, vhdlParser::Design_fileContext *ctx);
 
+    /// @brief Translate a single design unit and append it to the design file
+    void buildDesignUnit(ast::DesignFile &dest, vhdlParser::Design_unitContext *ctx);
+
+    /// @brief Append the source text between two tokens as an unparsed design unit
+    void buildRawUnit(ast::DesignFile &dest, std::size_t start_index, std::size_t stop_index);
+
     ~Translator() = default;
 
     Translator(const Translator &) = delete;
@@ -143,6 +161,12 @@ class Translator final
     auto makeRangeConstraint(vhdlParser::Range_constraintContext *ctx)
       -> std::optional<ast::RangeConstraint>;
 
+    /// @brief Source text of a context without hidden tokens, same as `ctx->getText()`
+    /// @note Reads the default-channel tokens of the span in one pass instead of recursively
+    ///       concatenating the text of every subtree.
+    [[nodiscard]]
+    auto textOf(const antlr4::ParserRuleContext *ctx) const -> std::string;
+
     /// @brief Helper to create and bind an AST node with trivia
     template<typename T, typename Ctx>
     [[nodiscard]]
@@ -166,6 +190,33 @@ class Translator final
         return bin;
     }
 
+    /// @brief Helper to fold a left-associative operator chain `x op y op z ...`
+    /// @note Only the outermost node is bound to the trivia of `ctx`; inner links get none.
+    template<typename Ctx, typename OperandCtx, typename OperatorCtx>
+    [[nodiscard]]
+    auto makeChain(const Ctx *ctx,
+                   ast::Expr first,
+                   const std::vector<OperandCtx *> &operands,
+                   const std::vector<OperatorCtx *> &operators,
+                   auto (Translator::*make_operand)(OperandCtx *)->ast::Expr) -> ast::Expr
+    {
+        for (std::size_t i = 0; i < operators.size(); ++i) {
+            auto right = (this->*make_operand)(operands[i + 1]);
+            auto op = textOf(operators[i]);
+
+            if (i + 1 == operators.size()) {
+                return makeBinary(ctx, std::move(op), std::move(first), std::move(right));
+            }
+
+            ast::BinaryExpr link{};
+            link.op = std::move(op);
+            link.left = std::make_unique<ast::Expr>(std::move(first));
+            link.right = std::make_unique<ast::Expr>(std::move(right));
+            first = std::move(link);
+        }
+        return first;
+    }
+
     /// @brief Helper to create unary expressions
     template<typename Ctx>
     [[nodiscard]]
@@ -1,4 +1,5 @@
 #include "ast/nodes/statements.hpp"
+#include "ast/symbol.hpp"
 #include "builder/translator.hpp"
 #include "vhdlParser.h"
 
@@ -74,15 +75,15 @@ auto Translator::makeProcess(vhdlParser::Process_statementContext *ctx) -> ast::
     // Extract label if present
     if (auto *label = ctx->label_colon()) {
         if (auto *id = label->identifier()) {
-            proc.label = id->getText();
+            proc.label = textOf(id);
         }
     }
 
     // Extract sensitivity list
     if (auto *sens_list = ctx->sensitivity_list()) {
         proc.sensitivity_list = sens_list->name()
-                              | std::views::transform([](auto *name) { return name->getText(); })
-                              | std::ranges::to<std::vector>();
+                              | std::views::transform([this](auto *name) { return textOf(name); })
+                              | std::ranges::to<std::vector<ast::Symbol>>();
     }
 
     // Extract sequential statements
@@ -79,7 +79,7 @@ auto Translator::makeForLoop(vhdlParser::Loop_statementContext *ctx) -> ast::For
     if (auto *iter = ctx->iteration_scheme()) {
         if (auto *param = iter->parameter_specification()) {
             if (auto *id = param->identifier()) {
-                loop.iterator = id->getText();
+                loop.iterator = textOf(id);
             }
 
             if (auto *range = param->discrete_range()) {
@@ -90,12 +90,12 @@ auto Translator::makeForLoop(vhdlParser::Loop_statementContext *ctx) -> ast::For
                     } else {
                         // It's a name
                         auto tok = make<ast::TokenExpr>(range_decl);
-                        tok.text = range_decl->getText();
+                        tok.text = textOf(range_decl);
                         loop.range = tok;
                     }
                 } else if (auto *subtype = range->subtype_indication()) {
                     auto tok = make<ast::TokenExpr>(subtype);
-                    tok.text = subtype->getText();
+                    tok.text = textOf(subtype);
                     loop.range = tok;
                 }
             }
@@ -1,5 +1,6 @@
 #include "ast/nodes/declarations.hpp"
 #include "ast/nodes/design_units.hpp"
+#include "ast/symbol.hpp"
 #include "builder/translator.hpp"
 #include "common/range_helpers.hpp"
 #include "vhdlParser.h"
@@ -59,11 +60,11 @@ auto Translator::makeGenericParam(vhdlParser::Interface_constant_declarationCont
     auto param = make<ast::GenericParam>(ctx);
 
     param.names = ctx->identifier_list()->identifier()
-                | std::views::transform([](auto *id) { return id->getText(); })
-                | std::ranges::to<std::vector>();
+                | std::views::transform([this](auto *id) { return textOf(id); })
+                | std::ranges::to<std::vector<ast::Symbol>>();
 
     if (auto *stype = ctx->subtype_indication()) {
-        param.type_name = stype->getText();
+        param.type_name = textOf(stype);
     }
 
     if (auto *expr = ctx->expression()) {
@@ -83,15 +84,15 @@ auto Translator::makeSignalPort(vhdlParser::Interface_port_declarationContext *c
     auto port = make<ast::Port>(ctx);
 
     port.names = ctx->identifier_list()->identifier()
-               | std::views::transform([](auto *id) { return id->getText(); })
-               | std::ranges::to<std::vector>();
+               | std::views::transform([this](auto *id) { return textOf(id); })
+               | std::ranges::to<std::vector<ast::Symbol>>();
 
     if (auto *mode = ctx->signal_mode()) {
-        port.mode = mode->getText();
+        port.mode = textOf(mode);
     }
 
     if (auto *stype = ctx->subtype_indication()) {
-        port.type_name = stype->selected_name(0)->getText();
+        port.type_name = textOf(stype->selected_name(0));
 
         if (auto *constraint_ctx = stype->constraint()) {
             port.constraint = makeConstraint(constraint_ctx);
@@ -112,11 +113,11 @@ auto Translator::makeConstantDecl(vhdlParser::Constant_declarationContext *ctx)
     auto decl = make<ast::ConstantDecl>(ctx);
 
     decl.names = ctx->identifier_list()->identifier()
-               | std::views::transform([](auto *id) { return id->getText(); })
-               | std::ranges::to<std::vector>();
+               | std::views::transform([this](auto *id) { return textOf(id); })
+               | std::ranges::to<std::vector<ast::Symbol>>();
 
     if (auto *stype = ctx->subtype_indication()) {
-        decl.type_name = stype->selected_name(0)->getText();
+        decl.type_name = textOf(stype->selected_name(0));
     }
 
     if (auto *expr = ctx->expression()) {
@@ -131,11 +132,11 @@ auto Translator::makeSignalDecl(vhdlParser::Signal_declarationContext *ctx) -> a
     auto decl = make<ast::SignalDecl>(ctx);
 
     decl.names = ctx->identifier_list()->identifier()
-               | std::views::transform([](auto *id) { return id->getText(); })
-               | std::ranges::to<std::vector>();
+               | std::views::transform([this](auto *id) { return textOf(id); })
+               | std::ranges::to<std::vector<ast::Symbol>>();
 
     if (auto *stype = ctx->subtype_indication()) {
-        decl.type_name = stype->selected_name(0)->getText();
+        decl.type_name = textOf(stype->selected_name(0));
 
         if (auto *constraint_ctx = stype->constraint()) {
             decl.constraint = makeConstraint(constraint_ctx);
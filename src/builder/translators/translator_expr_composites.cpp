@@ -53,7 +53,7 @@ auto Translator::makeChoice(vhdlParser::ChoiceContext *ctx) -> ast::Expr
         return makeToken(ctx, "others");
     }
     if (ctx->identifier() != nullptr) {
-        return makeToken(ctx, ctx->identifier()->getText());
+        return makeToken(ctx, textOf(ctx->identifier()));
     }
     if (ctx->simple_expression() != nullptr) {
         return makeSimpleExpr(ctx->simple_expression());
@@ -65,7 +65,7 @@ auto Translator::makeChoice(vhdlParser::ChoiceContext *ctx) -> ast::Expr
             }
         }
     }
-    return makeToken(ctx, ctx->getText());
+    return makeToken(ctx, textOf(ctx));
 }
 
 // ---------------------- Constraints/Ranges ----------------------
@@ -138,7 +138,7 @@ auto Translator::makeRange(vhdlParser::Explicit_rangeContext *ctx) -> ast::Expr
     }
 
     return makeBinary(ctx,
-                      ctx->direction()->getText(),
+                      textOf(ctx->direction()),
                       makeSimpleExpr(ctx->simple_expression(0)),
                       makeSimpleExpr(ctx->simple_expression(1)));
 }
@@ -25,25 +25,25 @@ auto Translator::makeName(vhdlParser::NameContext *ctx) -> ast::Expr
 
     if (!has_structure) {
         // Simple name (possibly with dots like "rec.field") - keep as one token
-        return makeToken(ctx, ctx->getText());
+        return makeToken(ctx, textOf(ctx));
     }
 
     // Has structural parts - build up the base, then apply operations
     // Start with the identifier/literal and consume any leading dot selections
     std::string base_text;
     if (ctx->identifier() != nullptr) {
-        base_text = ctx->identifier()->getText();
+        base_text = textOf(ctx->identifier());
     } else if (ctx->STRING_LITERAL() != nullptr) {
         base_text = ctx->STRING_LITERAL()->getText();
     } else {
         // Shouldn't happen, but fallback
-        return makeToken(ctx, ctx->getText());
+        return makeToken(ctx, textOf(ctx));
     }
 
     // Consume consecutive selected_name_parts into base
     auto it = parts.begin();
     while (it != parts.end() && (*it)->selected_name_part() != nullptr) {
-        base_text += (*it)->getText();
+        base_text += textOf(*it);
         ++it;
     }
 
@@ -76,10 +76,10 @@ auto Translator::makeSliceExpr(ast::Expr base, vhdlParser::Slice_name_partContex
             if (auto *er = rd->explicit_range()) {
                 slice_expr.args = std::make_unique<ast::Expr>(makeRange(er));
             } else {
-                slice_expr.args = std::make_unique<ast::Expr>(makeToken(rd, rd->getText()));
+                slice_expr.args = std::make_unique<ast::Expr>(makeToken(rd, textOf(rd)));
             }
         } else if (auto *subtype = dr->subtype_indication()) {
-            slice_expr.args = std::make_unique<ast::Expr>(makeToken(subtype, subtype->getText()));
+            slice_expr.args = std::make_unique<ast::Expr>(makeToken(subtype, textOf(subtype)));
         }
     }
 
@@ -89,7 +89,7 @@ auto Translator::makeSliceExpr(ast::Expr base, vhdlParser::Slice_name_partContex
 auto Translator::makeSelectExpr(ast::Expr base, vhdlParser::Selected_name_partContext *ctx)
   -> ast::Expr
 {
-    return makeBinary(ctx, ".", std::move(base), makeToken(ctx, ctx->getText().substr(1)));
+    return makeBinary(ctx, ".", std::move(base), makeToken(ctx, textOf(ctx).substr(1)));
 }
 
 auto Translator::makeCallExpr(ast::Expr base,
@@ -113,7 +113,7 @@ auto Translator::makeCallExpr(ast::Expr base,
                 call_expr.args = std::make_unique<ast::Expr>(ast::Expr{ std::move(group) });
             }
         } else {
-            call_expr.args = std::make_unique<ast::Expr>(makeToken(ctx, ctx->getText()));
+            call_expr.args = std::make_unique<ast::Expr>(makeToken(ctx, textOf(ctx)));
         }
     }
 
@@ -123,7 +123,7 @@ auto Translator::makeCallExpr(ast::Expr base,
 auto Translator::makeAttributeExpr(ast::Expr base, vhdlParser::Attribute_name_partContext *ctx)
   -> ast::Expr
 {
-    return makeBinary(ctx, "'", std::move(base), makeToken(ctx, ctx->getText().substr(1)));
+    return makeBinary(ctx, "'", std::move(base), makeToken(ctx, textOf(ctx).substr(1)));
 }
 
 auto Translator::makeCallArgument(vhdlParser::Association_elementContext *ctx) -> ast::Expr
@@ -133,11 +133,11 @@ auto Translator::makeCallArgument(vhdlParser::Association_elementContext *ctx) -
             if (auto *expr = designator->expression()) {
                 return makeExpr(expr);
             }
-            return makeToken(designator, designator->getText());
+            return makeToken(designator, textOf(designator));
         }
-        return makeToken(actual, actual->getText());
+        return makeToken(actual, textOf(actual));
     }
-    return makeToken(ctx, ctx->getText());
+    return makeToken(ctx, textOf(ctx));
 }
 
 } // namespace builder
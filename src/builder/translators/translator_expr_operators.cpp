@@ -2,19 +2,43 @@
 #include "builder/translator.hpp"
 #include "vhdlParser.h"
 
+#include <ParserRuleContext.h>
+#include <Token.h>
 #include <memory>
+#include <string>
+#include <utility>
 
 namespace builder {
 
+namespace {
+
+/// @brief Returns the only token of a context spanning exactly one token, nullptr otherwise
+auto singleToken(const antlr4::ParserRuleContext *ctx) -> antlr4::Token *
+{
+    auto *start = ctx->getStart();
+    const auto *stop = ctx->getStop();
+    if (start == nullptr || stop == nullptr || start->getTokenIndex() != stop->getTokenIndex()) {
+        return nullptr;
+    }
+    return start;
+}
+
+} // namespace
+
 auto Translator::makeExpr(vhdlParser::ExpressionContext *ctx) -> ast::Expr
 {
-    if (ctx->relation().size() == 1) {
-        return makeRelation(ctx->relation(0));
+    // Most expressions are a single name or literal, which every precedence level would
+    // just pass through down to one TokenExpr with the same span
+    if (const auto *token = singleToken(ctx)) {
+        return makeToken(ctx, token->getText());
     }
-    return makeBinary(ctx,
-                      ctx->logical_operator(0)->getText(),
-                      makeRelation(ctx->relation(0)),
-                      makeRelation(ctx->relation(1)));
+
+    const auto relations = ctx->relation();
+    return makeChain(ctx,
+                     makeRelation(relations.front()),
+                     relations,
+                     ctx->logical_operator(),
+                     &Translator::makeRelation);
 }
 
 auto Translator::makeRelation(vhdlParser::RelationContext *ctx) -> ast::Expr
@@ -23,7 +47,7 @@ auto Translator::makeRelation(vhdlParser::RelationContext *ctx) -> ast::Expr
         return makeShiftExpr(ctx->shift_expression(0));
     }
     return makeBinary(ctx,
-                      ctx->relational_operator()->getText(),
+                      textOf(ctx->relational_operator()),
                       makeShiftExpr(ctx->shift_expression(0)),
                       makeShiftExpr(ctx->shift_expression(1)));
 }
@@ -34,32 +58,46 @@ auto Translator::makeShiftExpr(vhdlParser::Shift_expressionContext *ctx) -> ast:
         return makeSimpleExpr(ctx->simple_expression(0));
     }
     return makeBinary(ctx,
-                      ctx->shift_operator()->getText(),
+                      textOf(ctx->shift_operator()),
                       makeSimpleExpr(ctx->simple_expression(0)),
                       makeSimpleExpr(ctx->simple_expression(1)));
 }
 
 auto Translator::makeSimpleExpr(vhdlParser::Simple_expressionContext *ctx) -> ast::Expr
 {
-    if (ctx->PLUS() != nullptr || ctx->MINUS() != nullptr) {
-        return makeUnary(ctx, ctx->PLUS() != nullptr ? "+" : "-", makeTerm(ctx->term(0)));
+    // Same shortcut as makeExpr, for ranges and shift operands
+    if (const auto *token = singleToken(ctx)) {
+        return makeToken(ctx, token->getText());
     }
-    if (ctx->adding_operator().empty()) {
-        return makeTerm(ctx->term(0));
+
+    const auto terms = ctx->term();
+    const auto operators = ctx->adding_operator();
+    auto first = makeTerm(terms.front());
+
+    if (ctx->PLUS() != nullptr || ctx->MINUS() != nullptr) {
+        std::string sign = ctx->PLUS() != nullptr ? "+" : "-";
+        if (operators.empty()) {
+            return makeUnary(ctx, std::move(sign), std::move(first));
+        }
+
+        // The sign only covers the first term; the chain built on it carries the trivia
+        ast::UnaryExpr un{};
+        un.op = std::move(sign);
+        un.value = std::make_unique<ast::Expr>(std::move(first));
+        first = std::move(un);
     }
-    return makeBinary(
-      ctx, ctx->adding_operator(0)->getText(), makeTerm(ctx->term(0)), makeTerm(ctx->term(1)));
+
+    return makeChain(ctx, std::move(first), terms, operators, &Translator::makeTerm);
 }
 
 auto Translator::makeTerm(vhdlParser::TermContext *ctx) -> ast::Expr
 {
-    if (ctx->multiplying_operator().empty()) {
-        return makeFactor(ctx->factor(0));
-    }
-    return makeBinary(ctx,
-                      ctx->multiplying_operator(0)->getText(),
-                      makeFactor(ctx->factor(0)),
-                      makeFactor(ctx->factor(1)));
+    const auto factors = ctx->factor();
+    return makeChain(ctx,
+                     makeFactor(factors.front()),
+                     factors,
+                     ctx->multiplying_operator(),
+                     &Translator::makeFactor);
 }
 
 auto Translator::makeFactor(vhdlParser::FactorContext *ctx) -> ast::Expr
@@ -89,7 +127,7 @@ auto Translator::makePrimary(vhdlParser::PrimaryContext *ctx) -> ast::Expr
     if (auto *name_ctx = ctx->name()) {
         return makeName(name_ctx);
     }
-    return makeToken(ctx, ctx->getText());
+    return makeToken(ctx, textOf(ctx));
 }
 
 } // namespace builder
@@ -19,7 +19,7 @@ auto Translator::makeTarget(vhdlParser::TargetContext *ctx) -> ast::Expr
 
     // Fallback: return token with context text
     auto token = make<ast::TokenExpr>(ctx);
-    token.text = ctx->getText();
+    token.text = textOf(ctx);
     return token;
 }
 
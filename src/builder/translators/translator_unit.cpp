@@ -1,8 +1,16 @@
 #include "ast/nodes/design_file.hpp"
 #include "ast/nodes/design_units.hpp"
 #include "builder/translator.hpp"
+#include "common/trace.hpp"
 #include "vhdlParser.h"
 
+#include <ParserRuleContext.h>
+#include <Token.h>
+#include <cstddef>
+#include <misc/Interval.h>
+#include <string>
+#include <utility>
+
 namespace builder {
 
 // ---------------------- Top-level ----------------------
@@ -10,40 +18,57 @@ namespace builder {
 void Translator::buildDesignFile(ast::DesignFile &dest, vhdlParser::Design_fileContext *ctx)
 {
     for (auto *unit_ctx : ctx->design_unit()) {
-        auto *lib_unit = unit_ctx->library_unit();
-        if (lib_unit == nullptr) {
-            continue;
-        }
+        buildDesignUnit(dest, unit_ctx);
+    }
+}
 
-        // Check primary units (entity_declaration | configuration_declaration |
-        // package_declaration)
-        if (auto *primary = lib_unit->primary_unit()) {
-            if (auto *entity_ctx = primary->entity_declaration()) {
-                dest.units.emplace_back(makeEntity(entity_ctx));
-            }
-            // TODO(someone): Handle configuration_declaration and package_declaration
+void Translator::buildDesignUnit(ast::DesignFile &dest, vhdlParser::Design_unitContext *ctx)
+{
+    const common::TraceSpan span("translate unit");
+
+    auto *lib_unit = ctx->library_unit();
+    if (lib_unit == nullptr) {
+        return;
+    }
+
+    // Check primary units (entity_declaration | configuration_declaration |
+    // package_declaration)
+    if (auto *primary = lib_unit->primary_unit()) {
+        if (auto *entity_ctx = primary->entity_declaration()) {
+            dest.units.emplace_back(makeEntity(entity_ctx));
         }
-        // Check secondary units (architecture_body | package_body)
-        else if (auto *secondary = lib_unit->secondary_unit()) {
-            if (auto *arch_ctx = secondary->architecture_body()) {
-                dest.units.emplace_back(makeArchitecture(arch_ctx));
-            }
-            // TODO(someone): Handle package_body
+        // TODO(someone): Handle configuration_declaration and package_declaration
+    }
+    // Check secondary units (architecture_body | package_body)
+    else if (auto *secondary = lib_unit->secondary_unit()) {
+        if (auto *arch_ctx = secondary->architecture_body()) {
+            dest.units.emplace_back(makeArchitecture(arch_ctx));
         }
+        // TODO(someone): Handle package_body
     }
 }
 
+void Translator::buildRawUnit(ast::DesignFile &dest,
+                              const std::size_t start_index,
+                              const std::size_t stop_index)
+{
+    ast::RawUnit unit{};
+    trivia_.bind(unit, start_index, stop_index);
+    unit.text = tokens_.getText(antlr4::misc::Interval(start_index, stop_index));
+    dest.units.emplace_back(std::move(unit));
+}
+
 // ---------------------- Design units ----------------------
 
 auto Translator::makeEntity(vhdlParser::Entity_declarationContext *ctx) -> ast::Entity
 {
     auto entity = make<ast::Entity>(ctx);
 
-    entity.name = ctx->identifier(0)->getText();
+    entity.name = textOf(ctx->identifier(0));
 
     // Optional end label (ENTITY ... END ENTITY <id>)
     if (ctx->identifier().size() > 1) {
-        entity.end_label = ctx->identifier(1)->getText();
+        entity.end_label = textOf(ctx->identifier(1));
     }
 
     if (auto *header = ctx->entity_header()) {
@@ -62,8 +87,8 @@ auto Translator::makeArchitecture(vhdlParser::Architecture_bodyContext *ctx) ->
 {
     auto arch = make<ast::Architecture>(ctx);
 
-    arch.name = ctx->identifier(0)->getText();
-    arch.entity_name = ctx->identifier(1)->getText();
+    arch.name = textOf(ctx->identifier(0));
+    arch.entity_name = textOf(ctx->identifier(1));
 
     // Walk declarative part and collect declarations directly
     if (auto *decl_part = ctx->architecture_declarative_part()) {
@@ -94,4 +119,24 @@ auto Translator::makeArchitecture(vhdlParser::Architecture_bodyContext *ctx) ->
     return arch;
 }
 
+// ---------------------- Helpers ----------------------
+
+auto Translator::textOf(const antlr4::ParserRuleContext *ctx) const -> std::string
+{
+    const auto *start = ctx->getStart();
+    const auto *stop = ctx->getStop();
+    if (start == nullptr || stop == nullptr || stop->getTokenIndex() < start->getTokenIndex()) {
+        return {};
+    }
+
+    std::string text{};
+    for (auto i = start->getTokenIndex(); i <= stop->getTokenIndex(); ++i) {
+        const auto *token = tokens_.get(i);
+        if (token->getChannel() == antlr4::Token::DEFAULT_CHANNEL) {
+            text += token->getText();
+        }
+    }
+    return text;
+}
+
 } // namespace builder
@@ -5,18 +5,59 @@
 #include "Token.h"
 #include "ast/node.hpp"
 #include "builder/trivia/utils.hpp"
+#include "common/counters.hpp"
+#include "common/stats.hpp"
 
+#include <algorithm>
 #include <cstddef>
-#include <optional>
-#include <ranges>
-#include <span>
+#include <iterator>
+#include <utility>
 #include <vector>
 
 namespace builder {
 
-TriviaBinder::TriviaBinder(antlr4::CommonTokenStream &ts) : tokens_(ts), used_(ts.size()) {}
+TriviaBinder::TriviaBinder(antlr4::CommonTokenStream &ts) : TriviaBinder(ts, nullptr) {}
 
-void TriviaBinder::collect(std::vector<ast::Trivia> &dst, std::span<antlr4::Token *const> tokens)
+TriviaBinder::TriviaBinder(antlr4::CommonTokenStream &ts, common::PipelineStats *stats) :
+  tokens_(ts),
+  stats_(stats)
+{
+    // Lines only grow along the stream, so the last write per line wins
+    for (std::size_t i = 0; i < tokens_.size(); ++i) {
+        const auto *token = tokens_.get(i);
+        if (!isDefault(token)) {
+            continue;
+        }
+
+        const auto line = token->getLine();
+        if (line >= last_default_on_line_.size()) {
+            last_default_on_line_.resize(line + 1);
+        }
+        last_default_on_line_[line] = i;
+    }
+}
+
+auto TriviaBinder::isClaimed(const std::size_t index) const noexcept -> bool
+{
+    // Only the last run starting at or before `index` can contain it
+    const auto it = std::ranges::upper_bound(claimed_, index, {}, &Span::begin);
+    return it != claimed_.begin() && index < std::prev(it)->end;
+}
+
+void TriviaBinder::claim(const Span span)
+{
+    if (span.begin >= span.end) {
+        return;
+    }
+
+    // Nodes are bound close to source order, so this is almost always an append
+    const auto it = std::ranges::upper_bound(claimed_, span.begin, {}, &Span::begin);
+    claimed_.insert(it, span);
+}
+
+auto TriviaBinder::collect(std::vector<ast::Trivia> &dst,
+                           const std::size_t begin,
+                           const std::size_t limit) const -> std::size_t
 {
     unsigned int linebreaks{ 0 };
 
@@ -27,13 +68,14 @@ void TriviaBinder::collect(std::vector<ast::Trivia> &dst, std::span<antlr4::Toke
         linebreaks = 0; // Reset after processing
     };
 
-    for (const auto *token : tokens) {
-        const auto index = token->getTokenIndex();
+    std::size_t index = begin;
+    for (; index < limit; ++index) {
+        const auto *token = tokens_.get(index);
+        common::count(common::Counter::TRIVIA_TOKENS);
 
-        if (used_[index]) {
-            continue;
+        if (isDefault(token)) {
+            break;
         }
-        used_[index] = true;
 
         if (isNewline(token)) {
             ++linebreaks;
@@ -48,21 +90,44 @@ void TriviaBinder::collect(std::vector<ast::Trivia> &dst, std::span<antlr4::Toke
 
     // Process any remaining linebreaks at the end
     process_linebreaks();
+
+    return index;
 }
 
-void TriviaBinder::collectInline(std::optional<ast::Comment> &dst, const std::size_t index)
+void TriviaBinder::collectLeading(std::vector<ast::Trivia> &dst, const std::size_t start_index)
 {
-    if (used_[index]) {
+    if (start_index == 0 || isClaimed(start_index - 1)) {
         return;
     }
 
-    const auto &token = tokens_.get(index);
+    // Walk back to the start of the hidden run in front of the node
+    std::size_t begin = start_index;
+    while (begin > 0 && !isDefault(tokens_.get(begin - 1))) {
+        --begin;
+    }
+    common::count(common::Counter::LEADING_WALKS);
+    common::count(common::Counter::LEADING_WALK_TOKENS, start_index - begin);
 
-    if (isComment(token)) {
-        used_[index] = true;
-        dst.emplace(ast::Comment{ token->getText() });
-        return; // only one inline comment per node
+    collect(dst, begin, start_index);
+    claim(Span{ .begin = begin, .end = start_index });
+}
+
+void TriviaBinder::collectTrailing(ast::NodeTrivia &dst, const std::size_t last_index)
+{
+    const auto begin = last_index + 1;
+    if (begin >= tokens_.size() || isClaimed(begin)) {
+        return;
     }
+
+    // A comment right after the last token of the line is the inline comment (only one)
+    auto rest = begin;
+    if (const auto *token = tokens_.get(begin); isComment(token)) {
+        dst.inline_comment.emplace(ast::Comment{ token->getText() });
+        ++rest;
+    }
+
+    const auto end = collect(dst.trailing, rest, tokens_.size());
+    claim(Span{ .begin = begin, .end = end });
 }
 
 void TriviaBinder::bind(ast::NodeBase &node, const antlr4::ParserRuleContext *ctx)
@@ -71,40 +136,45 @@ void TriviaBinder::bind(ast::NodeBase &node, const antlr4::ParserRuleContext *ct
         return;
     }
 
-    auto &trivia = node.trivia.emplace();
-
-    const auto start_index = ctx->getStart()->getTokenIndex();
-    const auto stop_index = findLastDefault(ctx->getStop()->getTokenIndex());
-
-    collect(trivia.leading, tokens_.getHiddenTokensToLeft(start_index));
-    collectInline(trivia.inline_comment, stop_index + 1);
-    collect(trivia.trailing, tokens_.getHiddenTokensToRight(stop_index));
+    bind(node, ctx->getStart()->getTokenIndex(), ctx->getStop()->getTokenIndex());
 }
 
-auto TriviaBinder::findLastDefault(const std::size_t start_index) const noexcept -> std::size_t
+void TriviaBinder::bind(ast::NodeBase &node,
+                        const std::size_t start_index,
+                        const std::size_t stop_index)
 {
-    const auto *start_token = tokens_.get(start_index);
-    if (start_token == nullptr || !isDefault(start_token)) {
-        return start_index;
+    // Counted only: a timer here would read the clock twice per node and inflate the
+    // enclosing PARSE or TRANSLATE phase
+    if (stats_ != nullptr) {
+        ++stats_->ast_nodes;
     }
 
-    const auto line = start_token->getLine();
+    // Collected on the stack: empty vectors do not allocate, and the node only gets a trivia
+    // slot when something was actually found
+    ast::NodeTrivia trivia{};
 
-    std::size_t result = start_index;
+    const auto last_index = findLastDefault(stop_index);
 
-    for (const auto i : std::views::iota(start_index + 1)) {
-        const auto *token = tokens_.get(i);
+    collectLeading(trivia.leading, start_index);
+    collectTrailing(trivia, last_index);
 
-        if (token == nullptr || token->getLine() != line) {
-            break;
-        }
+    if (!trivia.leading.empty() || !trivia.trailing.empty() || trivia.inline_comment) {
+        node.trivia = std::move(trivia);
+    }
+}
 
-        if (isDefault(token)) {
-            result = i;
-        }
+auto TriviaBinder::findLastDefault(const std::size_t start_index) const -> std::size_t
+{
+    if (start_index >= tokens_.size()) {
+        return start_index;
+    }
+
+    const auto *start_token = tokens_.get(start_index);
+    if (!isDefault(start_token)) {
+        return start_index;
     }
 
-    return result;
+    return last_default_on_line_[start_token->getLine()];
 }
 
 } // namespace builder
@@ -4,24 +4,33 @@
 #include "ast/node.hpp"
 
 #include <cstddef>
-#include <optional>
-#include <span>
 #include <vector>
 
 namespace antlr4 {
 class CommonTokenStream;
 class ParserRuleContext;
-class Token;
 } // namespace antlr4
 
+namespace common {
+struct PipelineStats;
+} // namespace common
+
 namespace builder {
 
 /// @brief Builds ordered trivia streams (comments + newlines) for AST nodes.
+///
+/// Each node claims the run of hidden tokens in front of it and the run after the end of its
+/// last line. Runs are walked in place, so every hidden token is read once, and claimed runs
+/// are remembered as spans instead of one flag per token of the stream.
 class TriviaBinder final
 {
   public:
+    /// @note `ts` must already be filled; its lines are indexed once, up front.
     explicit TriviaBinder(antlr4::CommonTokenStream &ts);
 
+    /// @brief Binder that also adds its bound node count to `stats`, if not null
+    TriviaBinder(antlr4::CommonTokenStream &ts, common::PipelineStats *stats);
+
     ~TriviaBinder() = default;
 
     TriviaBinder(const TriviaBinder &) = delete;
@@ -32,15 +41,49 @@ class TriviaBinder final
     /// @brief Binds collected trivia to the specified AST node.
     void bind(ast::NodeBase &node, const antlr4::ParserRuleContext *ctx);
 
+    /// @brief Binds collected trivia for a node spanning the given token indices.
+    /// @param start_index Index of the first default-channel token of the node
+    /// @param stop_index Index of the last default-channel token of the node
+    void bind(ast::NodeBase &node, std::size_t start_index, std::size_t stop_index);
+
   private:
+    /// @brief Half-open range of token indices
+    struct Span final
+    {
+        std::size_t begin;
+        std::size_t end;
+    };
+
     antlr4::CommonTokenStream &tokens_;
-    std::vector<bool> used_; ///< set of token indices already added as trivia
+    common::PipelineStats *stats_{ nullptr };
+
+    /// Index of the last default token on each line, indexed by line number
+    std::vector<std::size_t> last_default_on_line_;
+
+    /// Runs of hidden tokens already bound as trivia, sorted and disjoint. A run is always
+    /// claimed whole, as trivia starts or ends at a default token of its node.
+    std::vector<Span> claimed_;
+
+    [[nodiscard]]
+    auto isClaimed(std::size_t index) const noexcept -> bool;
+
+    void claim(Span span);
+
+    /// @brief Collects the hidden run left of `start_index` as leading trivia, unless claimed
+    void collectLeading(std::vector<ast::Trivia> &dst, std::size_t start_index);
+
+    /// @brief Collects the inline comment and trailing trivia right of `last_index`
+    void collectTrailing(ast::NodeTrivia &dst, std::size_t last_index);
 
-    void collect(std::vector<ast::Trivia> &dst, std::span<antlr4::Token *const> tokens);
-    void collectInline(std::optional<ast::Comment> &dst, std::size_t index);
+    /// @brief Appends the comments and paragraph breaks of the hidden tokens from `begin` up
+    ///        to the next default token or `limit`, whichever comes first
+    /// @return Index one past the last hidden token visited
+    auto collect(std::vector<ast::Trivia> &dst, std::size_t begin, std::size_t limit) const
+      -> std::size_t;
 
+    /// @brief Last default token on the line of `start_index`, which itself if not default
     [[nodiscard]]
-    auto findLastDefault(std::size_t start_index) const noexcept -> std::size_t;
+    auto findLastDefault(std::size_t start_index) const -> std::size_t;
 };
 
 } // namespace builder
@@ -23,6 +23,11 @@ namespace {
 constexpr std::string_view FLAG_WRITE{ "--write" };
 constexpr std::string_view FLAG_CHECK{ "--check" };
 constexpr std::string_view FLAG_LOCATION{ "--location" };
+constexpr std::string_view FLAG_RESILIENT{ "--resilient" };
+constexpr std::string_view FLAG_PROFILE_PARSER{ "--profile-parser" };
+constexpr std::string_view FLAG_STATS{ "--stats" };
+constexpr std::string_view FLAG_STATS_JSON{ "--stats-json" };
+constexpr std::string_view FLAG_TRACE{ "--trace" };
 
 } // namespace
 
@@ -41,6 +46,11 @@ auto ArgumentParser::getInputPath() const noexcept -> const std::filesystem::pat
     return input_path_;
 }
 
+auto ArgumentParser::getTracePath() const noexcept -> const std::optional<std::filesystem::path> &
+{
+    return trace_path_;
+}
+
 auto ArgumentParser::isFlagSet(ArgumentFlag flag) const noexcept -> bool
 {
     return used_flags_.test(static_cast<std::size_t>(flag));
@@ -84,6 +94,32 @@ auto ArgumentParser::parseArguments(std::span<const char *const> args) -> void
       .default_value(false)
       .implicit_value(true);
 
+    program.add_argument("-r", FLAG_RESILIENT)
+      .help("Formats the valid design units and keeps units with syntax errors unchanged")
+      .default_value(false)
+      .implicit_value(true);
+
+    program.add_argument("-p", FLAG_PROFILE_PARSER)
+      .help("Prints per-decision statistics of the ANTLR parser to stderr")
+      .default_value(false)
+      .implicit_value(true);
+
+    program.add_argument("-s", FLAG_STATS)
+      .help("Prints time, allocations and node counts of each formatting phase to stderr; "
+            "allocations are n/a unless built with VHDL_FMT_COUNT_ALLOCATIONS")
+      .default_value(false)
+      .implicit_value(true);
+
+    program.add_argument(FLAG_STATS_JSON)
+      .help("Like --stats, but prints the statistics as JSON")
+      .default_value(false)
+      .implicit_value(true);
+
+    program.add_argument(FLAG_TRACE)
+      .help("Writes a Chrome trace of the formatting phases to the given file (open in Perfetto)")
+      .metavar("trace.json")
+      .action([this](std::string_view location) -> void { trace_path_ = location; });
+
     program.add_argument("-l", FLAG_LOCATION)
       .help("Path to the configuration file (e.g., /path/to/vhdl-fmt.yaml)")
       .action([this](std::string_view location) -> void {
@@ -115,6 +151,13 @@ auto ArgumentParser::parseArguments(std::span<const char *const> args) -> void
 
         used_flags_.set(static_cast<std::size_t>(ArgumentFlag::WRITE), program.is_used(FLAG_WRITE));
         used_flags_.set(static_cast<std::size_t>(ArgumentFlag::CHECK), program.is_used(FLAG_CHECK));
+        used_flags_.set(static_cast<std::size_t>(ArgumentFlag::RESILIENT),
+                        program.is_used(FLAG_RESILIENT));
+        used_flags_.set(static_cast<std::size_t>(ArgumentFlag::PROFILE_PARSER),
+                        program.is_used(FLAG_PROFILE_PARSER));
+        used_flags_.set(static_cast<std::size_t>(ArgumentFlag::STATS), program.is_used(FLAG_STATS));
+        used_flags_.set(static_cast<std::size_t>(ArgumentFlag::STATS_JSON),
+                        program.is_used(FLAG_STATS_JSON));
 
     } catch (const std::exception &err) {
         std::cerr << std::format("Error parsing arguments: {}\n", err.what());
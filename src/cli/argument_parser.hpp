@@ -14,7 +14,11 @@ enum class ArgumentFlag : std::uint8_t
 {
     WRITE = 0,
     CHECK = 1,
-    FLAG_COUNT = 2 // Required for flag count
+    RESILIENT = 2,
+    PROFILE_PARSER = 3,
+    STATS = 4,
+    STATS_JSON = 5,
+    FLAG_COUNT = 6 // Required for flag count
 };
 
 class ArgumentParser final
@@ -28,6 +32,10 @@ class ArgumentParser final
     [[nodiscard]]
     auto getInputPath() const noexcept -> const std::filesystem::path &;
 
+    /// @brief File to write a Chrome trace of the run to, if requested
+    [[nodiscard]]
+    auto getTracePath() const noexcept -> const std::optional<std::filesystem::path> &;
+
     [[nodiscard]]
     auto isFlagSet(ArgumentFlag flag) const noexcept -> bool;
 
@@ -36,6 +44,7 @@ class ArgumentParser final
 
     std::optional<std::filesystem::path> config_file_path_;
     std::filesystem::path input_path_;
+    std::optional<std::filesystem::path> trace_path_;
     std::bitset<static_cast<std::size_t>(ArgumentFlag::FLAG_COUNT)> used_flags_;
 };
 
@@ -0,0 +1,168 @@
+#include "stats_report.hpp"
+
+#include "common/stats.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace cli {
+
+namespace {
+
+constexpr double NS_PER_MS{ 1'000'000.0 };
+constexpr std::size_t BYTES_PER_KIB{ 1024 };
+
+auto toMilliseconds(const std::chrono::nanoseconds time) -> double
+{
+    return static_cast<double>(time.count()) / NS_PER_MS;
+}
+
+auto sumOf(std::span<const common::PipelineStats> files) -> common::PipelineStats
+{
+    common::PipelineStats total{ .file = "total", .fast_path = !files.empty() };
+    for (const auto &file : files) {
+        total += file;
+    }
+    return total;
+}
+
+auto frontEndOf(const common::PipelineStats &stats) -> std::string_view
+{
+    return stats.fast_path ? "fast" : "antlr";
+}
+
+void appendTable(std::string &out, const common::PipelineStats &stats)
+{
+    out += std::format("{}\n", stats.file);
+    out += std::format("  {:<16} {:>10} {:>12} {:>14} {:>12}\n",
+                       "phase",
+                       "time (ms)",
+                       "allocs",
+                       "bytes",
+                       "RSS (KiB)");
+
+    for (std::size_t i = 0; i < common::PHASE_COUNT; ++i) {
+        const auto phase = static_cast<common::Phase>(i);
+        const auto &entry = stats.phase(phase);
+
+        // Sub-phases are indented under the phase that contains them
+        const auto name = common::isSubPhase(phase) ? std::format("  {}", common::phaseName(phase))
+                                                    : std::string{ common::phaseName(phase) };
+        const auto counted = [&](const std::uint64_t value) -> std::string {
+            return stats.allocations_counted ? std::to_string(value) : std::string{ "n/a" };
+        };
+        out += std::format("  {:<16} {:>10.3f} {:>12} {:>14} {:>12}\n",
+                           name,
+                           toMilliseconds(entry.time),
+                           counted(entry.allocations),
+                           counted(entry.bytes),
+                           entry.rss / BYTES_PER_KIB);
+    }
+
+    out += std::format("  front-end: {}, LL retries: {}\n", frontEndOf(stats), stats.ll_retries);
+    out += std::format("  tokens: {}, AST nodes: {}, Doc nodes: {}\n",
+                       stats.tokens,
+                       stats.ast_nodes,
+                       stats.doc_nodes);
+    out += std::format("  peak RSS: {} KiB\n", stats.peak_rss / BYTES_PER_KIB);
+}
+
+/// @brief Quote a string for JSON, escaping quotes, backslashes and control characters
+auto quoted(std::string_view text) -> std::string
+{
+    std::string out{ '"' };
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += std::format("\\u{:04x}", static_cast<unsigned>(c));
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+    return out;
+}
+
+/// @brief JSON key of a phase: its name with spaces replaced by underscores
+auto phaseKey(const common::Phase phase) -> std::string
+{
+    std::string key{ common::phaseName(phase) };
+    for (auto &c : key) {
+        if (c == ' ') {
+            c = '_';
+        }
+    }
+    return key;
+}
+
+void appendJson(std::string &out, const common::PipelineStats &stats)
+{
+    out += std::format(R"({{"file":{},"front_end":"{}","ll_retries":{},)",
+                       quoted(stats.file),
+                       frontEndOf(stats),
+                       stats.ll_retries);
+    out += std::format(R"("tokens":{},"ast_nodes":{},"doc_nodes":{},"peak_rss_bytes":{},)",
+                       stats.tokens,
+                       stats.ast_nodes,
+                       stats.doc_nodes,
+                       stats.peak_rss);
+    out += R"("phases":{)";
+
+    // Uncounted allocations are null rather than a misleading zero
+    const auto counted = [&](const std::uint64_t value) -> std::string {
+        return stats.allocations_counted ? std::to_string(value) : std::string{ "null" };
+    };
+
+    for (std::size_t i = 0; i < common::PHASE_COUNT; ++i) {
+        const auto phase = static_cast<common::Phase>(i);
+        const auto &entry = stats.phase(phase);
+        out += std::format(
+          R"({}"{}":{{"time_ms":{:.3f},"allocations":{},"bytes":{},"rss_bytes":{}}})",
+          i == 0 ? "" : ",",
+          phaseKey(phase),
+          toMilliseconds(entry.time),
+          counted(entry.allocations),
+          counted(entry.bytes),
+          entry.rss);
+    }
+
+    out += "}}";
+}
+
+} // namespace
+
+auto formatStats(std::span<const common::PipelineStats> files) -> std::string
+{
+    std::string out{};
+    for (const auto &file : files) {
+        appendTable(out, file);
+    }
+    if (files.size() > 1) {
+        appendTable(out, sumOf(files));
+    }
+    return out;
+}
+
+auto formatStatsJson(std::span<const common::PipelineStats> files) -> std::string
+{
+    std::string out{ R"({"files":[)" };
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (i != 0) {
+            out += ',';
+        }
+        appendJson(out, files[i]);
+    }
+    out += R"(],"total":)";
+    appendJson(out, sumOf(files));
+    out += "}\n";
+    return out;
+}
+
+} // namespace cli
@@ -0,0 +1,23 @@
+#ifndef CLI_STATS_REPORT_HPP
+#define CLI_STATS_REPORT_HPP
+
+#include "common/stats.hpp"
+
+#include <span>
+#include <string>
+
+namespace cli {
+
+/// @brief Render per-file statistics as plain text tables, followed by their total when
+///        there is more than one file
+[[nodiscard]]
+auto formatStats(std::span<const common::PipelineStats> files) -> std::string;
+
+/// @brief Render per-file statistics and their total as a JSON object
+///        (`{"files": [...], "total": {...}}`)
+[[nodiscard]]
+auto formatStatsJson(std::span<const common::PipelineStats> files) -> std::string;
+
+} // namespace cli
+
+#endif /* CLI_STATS_REPORT_HPP */
@@ -0,0 +1,110 @@
+#ifndef COMMON_COUNTERS_HPP
+#define COMMON_COUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace common {
+
+/// @brief Whether the hot-path counters are compiled in (CMake option VHDL_FMT_ENABLE_COUNTERS)
+#ifdef VHDL_FMT_ENABLE_COUNTERS
+constexpr bool COUNTERS_ENABLED{ true };
+#else
+constexpr bool COUNTERS_ENABLED{ false };
+#endif
+
+/// @brief Events counted on the hot paths
+enum class Counter : std::uint8_t
+{
+    FITS_CALLS,            ///< Renderer::fits, one per group decision
+    FITS_NODES,            ///< Renderer::fitsImpl, every node visited by those calls
+    CONCAT_EMPTY,          ///< makeConcat rule 1: an Empty side was dropped
+    CONCAT_TEXT_MERGE,     ///< makeConcat rule 2: adjacent Texts were merged
+    CONCAT_HARDLINE_MERGE, ///< makeConcat rule 3: adjacent hard lines were merged
+    CONCAT_NODE,           ///< makeConcat fallback: a Concat node was allocated
+    TRANSFORM_NODES,       ///< Nodes visited by transformImpl
+    FOLD_NODES,            ///< Nodes visited by foldImpl
+    TRIVIA_TOKENS,         ///< Tokens scanned by TriviaBinder::collect
+    LEADING_WALKS,         ///< Walks back over the hidden run in front of a node
+    LEADING_WALK_TOKENS,   ///< Hidden tokens stepped over by those walks
+    COUNT,
+};
+
+constexpr std::size_t COUNTER_COUNT{ static_cast<std::size_t>(Counter::COUNT) };
+
+[[nodiscard]]
+constexpr auto counterName(const Counter counter) -> std::string_view
+{
+    constexpr std::array<std::string_view, COUNTER_COUNT> NAMES{
+        "fits calls",
+        "fits nodes",
+        "concat empty dropped",
+        "concat text merged",
+        "concat lines merged",
+        "concat nodes",
+        "transform nodes",
+        "fold nodes",
+        "trivia tokens scanned",
+        "leading walks",
+        "leading walk tokens",
+    };
+    return NAMES.at(static_cast<std::size_t>(counter));
+}
+
+namespace detail {
+
+using CounterValues = std::array<std::uint64_t, COUNTER_COUNT>;
+
+/// @brief Sums of the threads that have exited
+inline auto counterTotals() noexcept -> std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> &
+{
+    static std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> totals{};
+    return totals;
+}
+
+/// @brief Plain per-thread counters, added to the totals when the thread exits
+struct ThreadCounters final
+{
+    CounterValues values{};
+
+    ThreadCounters() = default;
+    ThreadCounters(const ThreadCounters &) = delete;
+    auto operator=(const ThreadCounters &) -> ThreadCounters & = delete;
+    ThreadCounters(ThreadCounters &&) = delete;
+    auto operator=(ThreadCounters &&) -> ThreadCounters & = delete;
+
+    ~ThreadCounters()
+    {
+        for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+            counterTotals().at(i).fetch_add(values.at(i), std::memory_order_relaxed);
+        }
+    }
+};
+
+inline auto threadCounters() noexcept -> CounterValues &
+{
+    thread_local ThreadCounters counters{};
+    return counters.values;
+}
+
+} // namespace detail
+
+/// @brief Add `amount` to `counter`; compiles to nothing unless counters are enabled
+inline void count(const Counter counter, const std::uint64_t amount) noexcept
+{
+    if constexpr (COUNTERS_ENABLED) {
+        detail::threadCounters()[static_cast<std::size_t>(counter)] += amount;
+    }
+}
+
+inline void count(const Counter counter) noexcept
+{
+    count(counter, 1);
+}
+
+} // namespace common
+
+#endif /* COMMON_COUNTERS_HPP */
@@ -0,0 +1,63 @@
+#ifndef COMMON_COUNTERS_DUMP_HPP
+#define COMMON_COUNTERS_DUMP_HPP
+
+#include "common/counters.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <ostream>
+
+// Kept out of counters.hpp, which every hot-path translation unit includes. Include this once
+// per program that should print the counters at exit.
+
+namespace common {
+
+/// @brief Print the totals of every thread that has exited, the main thread included at exit
+inline void dumpCounters(std::ostream &out)
+{
+    const auto total = [](const Counter counter) -> std::uint64_t {
+        return detail::counterTotals()
+          .at(static_cast<std::size_t>(counter))
+          .load(std::memory_order_relaxed);
+    };
+
+    out << "counters:\n";
+    for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+        const auto counter = static_cast<Counter>(i);
+        out << std::format("  {:<24}{:>14}\n", counterName(counter), total(counter));
+    }
+
+    if (const auto calls = total(Counter::FITS_CALLS); calls > 0) {
+        out << std::format("  {:<24}{:>14.1f}\n",
+                           "fits nodes per call",
+                           static_cast<double>(total(Counter::FITS_NODES))
+                             / static_cast<double>(calls));
+    }
+}
+
+#ifdef VHDL_FMT_ENABLE_COUNTERS
+namespace detail {
+
+/// @brief Dumps the counters to stderr when static objects are destroyed at exit, which is
+/// after the main thread's counters have been added to the totals
+struct CounterDumpAtExit final
+{
+    CounterDumpAtExit() = default;
+    CounterDumpAtExit(const CounterDumpAtExit &) = delete;
+    auto operator=(const CounterDumpAtExit &) -> CounterDumpAtExit & = delete;
+    CounterDumpAtExit(CounterDumpAtExit &&) = delete;
+    auto operator=(CounterDumpAtExit &&) -> CounterDumpAtExit & = delete;
+
+    ~CounterDumpAtExit() { dumpCounters(std::cerr); }
+};
+
+inline const CounterDumpAtExit COUNTER_DUMP_AT_EXIT{};
+
+} // namespace detail
+#endif
+
+} // namespace common
+
+#endif /* COMMON_COUNTERS_DUMP_HPP */
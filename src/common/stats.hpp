@@ -0,0 +1,213 @@
+#ifndef COMMON_STATS_HPP
+#define COMMON_STATS_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace common {
+
+/// @brief Heap allocations made so far by one thread
+struct AllocationCount final
+{
+    std::uint64_t count{};
+    std::uint64_t bytes{};
+};
+
+/// @brief Allocation counters of the calling thread.
+///
+/// Bumped by the replacement `operator new` of programs that link `alloc_hooks.cpp`; in every
+/// other program they stay zero.
+inline auto threadAllocations() noexcept -> AllocationCount &
+{
+    thread_local AllocationCount counters{};
+    return counters;
+}
+
+/// @brief Whether this program links `alloc_hooks.cpp`, which sets it during static
+/// initialisation. Tells zero allocations apart from allocations that were never counted.
+inline auto allocationsCounted() noexcept -> bool &
+{
+    static bool counted{ false };
+    return counted;
+}
+
+/// @brief Resident memory of the process, in bytes
+struct MemorySample final
+{
+    std::size_t rss{};      ///< Current resident set size
+    std::size_t peak_rss{}; ///< High-water mark of the resident set size
+};
+
+/// @brief Read the resident set size from `/proc/self/status`; zeros where it does not exist
+inline auto sampleMemory() -> MemorySample
+{
+    constexpr std::size_t BYTES_PER_KIB = 1024;
+
+    // Lines look like "VmRSS:     1234 kB"
+    const auto kib_of = [](std::string_view line) -> std::size_t {
+        line.remove_prefix(std::min(line.find_first_of("0123456789"), line.size()));
+        std::size_t value{};
+        std::from_chars(line.data(), line.data() + line.size(), value);
+        return value * BYTES_PER_KIB;
+    };
+
+    MemorySample sample{};
+    std::ifstream status{ "/proc/self/status" };
+    for (std::string line{}; std::getline(status, line);) {
+        if (line.starts_with("VmRSS:")) {
+            sample.rss = kib_of(line);
+        } else if (line.starts_with("VmHWM:")) {
+            sample.peak_rss = kib_of(line);
+        }
+    }
+    return sample;
+}
+
+/// @brief Steps of the formatting pipeline measured by `--stats`
+enum class Phase : std::uint8_t
+{
+    ARGS,        ///< Parsing the command line
+    CONFIG,      ///< Loading the YAML configuration
+    SETUP,       ///< Constructing the lexer and parser, including ANTLR's ATN deserialisation
+    READ,        ///< Loading and decoding the source
+    LEX,         ///< Filling the token stream
+    PARSE,       ///< Fast path or ANTLR parse, including SLL -> LL retries
+    TRANSLATE,   ///< Parse tree to AST
+    DOC_BUILD,   ///< AST to Doc
+    RENDER,      ///< Doc to text
+    ALIGN,       ///< Resolving aligned columns, part of RENDER
+    COUNT,
+};
+
+constexpr std::size_t PHASE_COUNT{ static_cast<std::size_t>(Phase::COUNT) };
+
+[[nodiscard]]
+constexpr auto phaseName(const Phase phase) -> std::string_view
+{
+    constexpr std::array<std::string_view, PHASE_COUNT> NAMES{
+        "arguments", "config",    "setup",  "read",  "lex",   "parse",
+        "translate", "doc build", "render", "align",
+    };
+    return NAMES.at(static_cast<std::size_t>(phase));
+}
+
+/// @brief True for phases that are measured inside another one and must not be summed
+[[nodiscard]]
+constexpr auto isSubPhase(const Phase phase) -> bool
+{
+    return phase == Phase::ALIGN;
+}
+
+/// @brief Cost of one phase, summed over every time it ran
+struct PhaseStats final
+{
+    std::chrono::nanoseconds time{};
+    std::uint64_t allocations{};
+    std::uint64_t bytes{};
+    std::size_t rss{}; ///< Largest resident set size sampled at the end of the phase, 0 if none
+};
+
+/// @brief Measurements of the pipeline for one file, or the sum over several
+struct PipelineStats final
+{
+    std::string file;
+    std::array<PhaseStats, PHASE_COUNT> phases{};
+    bool fast_path{ false };     ///< Built by the hand-written parser, without ANTLR
+    std::size_t ll_retries{ 0 }; ///< Design units that SLL bailed on and LL parsed again
+    std::size_t tokens{ 0 };     ///< Tokens in the stream, hidden ones included
+    std::size_t ast_nodes{ 0 };  ///< AST nodes bound to their trivia
+    std::size_t doc_nodes{ 0 };
+    std::size_t peak_rss{ 0 }; ///< High-water mark of the resident set size, in bytes
+    /// Whether the phases' allocations were counted at all; they stay zero otherwise
+    bool allocations_counted{ allocationsCounted() };
+
+    /// @brief Record the process's memory use at the end of `phase`.
+    ///
+    /// Reads `/proc`, so call it at phase boundaries only, not per node.
+    void sampleMemory(const Phase phase)
+    {
+        const auto sample = common::sampleMemory();
+        auto &entry = this->phase(phase);
+        entry.rss = std::max(entry.rss, sample.rss);
+        peak_rss = std::max(peak_rss, sample.peak_rss);
+    }
+
+    [[nodiscard]]
+    auto phase(const Phase phase) -> PhaseStats &
+    {
+        return phases.at(static_cast<std::size_t>(phase));
+    }
+
+    [[nodiscard]]
+    auto phase(const Phase phase) const -> const PhaseStats &
+    {
+        return phases.at(static_cast<std::size_t>(phase));
+    }
+
+    /// @brief Add the measurements of another file; `file` is kept
+    auto operator+=(const PipelineStats &other) -> PipelineStats &
+    {
+        for (std::size_t i = 0; i < PHASE_COUNT; ++i) {
+            phases.at(i).time += other.phases.at(i).time;
+            phases.at(i).allocations += other.phases.at(i).allocations;
+            phases.at(i).bytes += other.phases.at(i).bytes;
+            phases.at(i).rss = std::max(phases.at(i).rss, other.phases.at(i).rss);
+        }
+        peak_rss = std::max(peak_rss, other.peak_rss);
+        fast_path = fast_path && other.fast_path;
+        allocations_counted = allocations_counted && other.allocations_counted;
+        ll_retries += other.ll_retries;
+        tokens += other.tokens;
+        ast_nodes += other.ast_nodes;
+        doc_nodes += other.doc_nodes;
+        return *this;
+    }
+};
+
+/// @brief Adds the wall time and allocations of its scope to one phase.
+///
+/// Does nothing, not even read the clock, when constructed without stats.
+class PhaseTimer final
+{
+  public:
+    PhaseTimer(PipelineStats *stats, const Phase phase) :
+      target_(stats != nullptr ? &stats->phase(phase) : nullptr)
+    {
+        if (target_ != nullptr) {
+            start_allocations_ = threadAllocations();
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PhaseTimer()
+    {
+        if (target_ == nullptr) {
+            return;
+        }
+        target_->time += std::chrono::steady_clock::now() - start_;
+        const auto &now = threadAllocations();
+        target_->allocations += now.count - start_allocations_.count;
+        target_->bytes += now.bytes - start_allocations_.bytes;
+    }
+
+    PhaseTimer(const PhaseTimer &) = delete;
+    auto operator=(const PhaseTimer &) -> PhaseTimer & = delete;
+    PhaseTimer(PhaseTimer &&) = delete;
+    auto operator=(PhaseTimer &&) -> PhaseTimer & = delete;
+
+  private:
+    PhaseStats *target_;
+    std::chrono::steady_clock::time_point start_;
+    AllocationCount start_allocations_;
+};
+
+} // namespace common
+
+#endif /* COMMON_STATS_HPP */
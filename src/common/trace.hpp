@@ -0,0 +1,183 @@
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+/// @brief Process-wide collector of trace spans, written as Chrome trace-event JSON.
+///
+/// The output opens in Perfetto or `chrome://tracing`, with one lane per thread that recorded
+/// anything. Disabled by default; spans then cost a single atomic load.
+class Tracer final
+{
+  public:
+    /// @brief The tracer shared by the whole process
+    static auto instance() -> Tracer &
+    {
+        static Tracer tracer{};
+        return tracer;
+    }
+
+    ~Tracer() = default;
+
+    Tracer(const Tracer &) = delete;
+    auto operator=(const Tracer &) -> Tracer & = delete;
+    Tracer(Tracer &&) = delete;
+    auto operator=(Tracer &&) -> Tracer & = delete;
+
+    /// @brief Start recording; timestamps are relative to the first call.
+    ///
+    /// The calling thread gets the first lane, labelled "main"; other threads are labelled
+    /// as workers in the order they record their first span.
+    void enable()
+    {
+        {
+            const std::scoped_lock lock(mutex_);
+            if (!enabled_.load(std::memory_order_relaxed)) {
+                origin_ = std::chrono::steady_clock::now();
+                enabled_.store(true, std::memory_order_release);
+            }
+        }
+        static_cast<void>(threadLane());
+    }
+
+    [[nodiscard]]
+    auto enabled() const noexcept -> bool
+    {
+        return enabled_.load(std::memory_order_acquire);
+    }
+
+    /// @brief Record a finished span on the calling thread's lane
+    void record(std::string_view name,
+                const std::chrono::steady_clock::time_point begin,
+                const std::chrono::steady_clock::time_point end)
+    {
+        auto &lane = threadLane();
+        const std::scoped_lock lock(lane.mutex);
+        lane.events.push_back(Event{ .name = std::string{ name }, .begin = begin, .end = end });
+    }
+
+    /// @brief All spans recorded so far as a Chrome trace-event JSON document
+    /// @note Span names are emitted verbatim, so they must not need JSON escaping
+    [[nodiscard]]
+    auto toJson() const -> std::string
+    {
+        const std::scoped_lock lock(mutex_);
+
+        std::string out{ R"({"displayTimeUnit":"ms","traceEvents":[)" };
+        bool first = true;
+        const auto separator = [&first]() -> std::string_view {
+            return std::exchange(first, false) ? "" : ",";
+        };
+
+        for (const auto &lane : lanes_) {
+            const std::scoped_lock lane_lock(lane->mutex);
+            out += std::format(
+              R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+              separator(),
+              lane->tid,
+              lane->tid == 0 ? "main" : std::format("worker {}", lane->tid));
+
+            for (const auto &event : lane->events) {
+                out += std::format(
+                  R"({}{{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                  separator(),
+                  event.name,
+                  lane->tid,
+                  toMicroseconds(event.begin - origin_),
+                  toMicroseconds(event.end - event.begin));
+            }
+        }
+
+        out += "]}\n";
+        return out;
+    }
+
+  private:
+    struct Event final
+    {
+        std::string name;
+        std::chrono::steady_clock::time_point begin;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    /// @brief Spans of one thread; only contended while the trace is written
+    struct Lane final
+    {
+        std::uint32_t tid{};
+        std::mutex mutex;
+        std::vector<Event> events;
+    };
+
+    Tracer() = default;
+
+    static auto toMicroseconds(const std::chrono::steady_clock::duration duration) -> double
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    /// @brief Lane of the calling thread, registered on first use and kept after it exits
+    auto threadLane() -> Lane &
+    {
+        thread_local std::shared_ptr<Lane> lane = [this] {
+            const std::scoped_lock lock(mutex_);
+            auto created = std::make_shared<Lane>();
+            created->tid = static_cast<std::uint32_t>(lanes_.size());
+            lanes_.push_back(created);
+            return created;
+        }();
+        return *lane;
+    }
+
+    std::atomic<bool> enabled_{ false };
+    std::chrono::steady_clock::time_point origin_;
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<Lane>> lanes_;
+};
+
+/// @brief Records its own lifetime as a span when tracing is enabled
+class TraceSpan final
+{
+  public:
+    /// @param name Span label, kept by view: pass a literal or a string outliving the span
+    explicit TraceSpan(const std::string_view name) :
+      name_(name),
+      active_(Tracer::instance().enabled())
+    {
+        if (active_) {
+            begin_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TraceSpan()
+    {
+        if (active_) {
+            Tracer::instance().record(name_, begin_, std::chrono::steady_clock::now());
+        }
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    auto operator=(const TraceSpan &) -> TraceSpan & = delete;
+    TraceSpan(TraceSpan &&) = delete;
+    auto operator=(TraceSpan &&) -> TraceSpan & = delete;
+
+  private:
+    std::string_view name_;
+    bool active_;
+    std::chrono::steady_clock::time_point begin_;
+};
+
+} // namespace common
+
+#endif /* COMMON_TRACE_HPP */
@@ -21,6 +21,7 @@ class PrettyPrinter final : public ast::VisitorBase<PrettyPrinter, Doc>
     auto operator()(const ast::DesignFile &node) const -> Doc;
     auto operator()(const ast::Entity &node) const -> Doc;
     auto operator()(const ast::Architecture &node) const -> Doc;
+    auto operator()(const ast::RawUnit &node) const -> Doc;
     auto operator()(const ast::GenericClause &node) const -> Doc;
     auto operator()(const ast::PortClause &node) const -> Doc;
     auto operator()(const ast::GenericParam &node) const -> Doc;
@@ -1,6 +1,7 @@
 #include "emit/pretty_printer/doc.hpp"
 
 #include "common/config.hpp"
+#include "common/stats.hpp"
 #include "emit/pretty_printer/doc_impl.hpp"
 #include "emit/pretty_printer/renderer.hpp"
 
@@ -144,8 +145,20 @@ auto Doc::group(const Doc &doc) -> Doc
 
 auto Doc::render(const common::Config &config) const -> std::string
 {
-    Renderer renderer(config);
-    return renderer.render(impl_);
+    return render(config, nullptr);
+}
+
+auto Doc::render(const common::Config &config, common::PipelineStats *stats) const -> std::string
+{
+    auto output = [&] {
+        const common::PhaseTimer timer(stats, common::Phase::RENDER);
+        Renderer renderer(config, stats);
+        return renderer.render(impl_);
+    }();
+    if (stats != nullptr) {
+        stats->sampleMemory(common::Phase::RENDER);
+    }
+    return output;
 }
 
 // =======================================================================
@@ -9,6 +9,7 @@
 // Forward declarations
 namespace common {
 struct Config;
+struct PipelineStats;
 } // namespace common
 
 namespace emit {
@@ -160,11 +161,22 @@ class Doc final
     [[nodiscard]]
     auto render(const common::Config &config) const -> std::string;
 
+    /// @brief Renders the document, adding the render and alignment time to `stats`.
+    /// @param config The configuration containing layout rules (line width, etc.)
+    /// @param stats Statistics to accumulate into, or nullptr
+    [[nodiscard]]
+    auto render(const common::Config &config, common::PipelineStats *stats) const -> std::string;
+
     /// @brief Checks if the document is an Empty node.
     /// @return True if the document is 'Doc::empty()', false otherwise.
     [[nodiscard]]
     auto isEmpty() const -> bool;
 
+    /// @brief The underlying node, for code that drives the layout passes directly.
+    /// @note Meant for benchmarks and tests; formatting code goes through the API above.
+    [[nodiscard]]
+    auto impl() const -> const DocPtr & { return impl_; }
+
   private:
     /// @brief Private constructor for internal factory functions.
     explicit Doc(std::shared_ptr<DocImpl> impl) : impl_(std::move(impl)) {}
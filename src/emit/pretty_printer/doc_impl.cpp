@@ -1,5 +1,6 @@
 #include "emit/pretty_printer/doc_impl.hpp"
 
+#include "common/counters.hpp"
 #include "common/overload.hpp"
 #include "emit/pretty_printer/doc.hpp"
 
@@ -46,11 +47,13 @@ auto makeConcat(DocPtr left, DocPtr right) -> DocPtr
     // === Rule 1: Identity (Empty) elimination ===
     const bool left_is_empty = !left || std::holds_alternative<Empty>(left->value);
     if (left_is_empty) {
+        common::count(common::Counter::CONCAT_EMPTY);
         return right;
     }
 
     const bool right_is_empty = !right || std::holds_alternative<Empty>(right->value);
     if (right_is_empty) {
+        common::count(common::Counter::CONCAT_EMPTY);
         return left;
     }
 
@@ -58,6 +61,7 @@ auto makeConcat(DocPtr left, DocPtr right) -> DocPtr
     if (auto *left_text = std::get_if<Text>(&left->value)) {
         if (auto *right_text = std::get_if<Text>(&right->value)) {
             // Create a new merged text node directly
+            common::count(common::Counter::CONCAT_TEXT_MERGE);
             return makeText(left_text->content + right_text->content);
         }
     }
@@ -74,6 +78,7 @@ auto makeConcat(DocPtr left, DocPtr right) -> DocPtr
     };
 
     if (auto lhs = get_lines(left), rhs = get_lines(right); lhs && rhs) {
+        common::count(common::Counter::CONCAT_HARDLINE_MERGE);
         const unsigned total_lines = *lhs + *rhs;
         if (total_lines == 1) {
             return makeHardLine();
@@ -83,6 +88,7 @@ auto makeConcat(DocPtr left, DocPtr right) -> DocPtr
     }
 
     // === Fallback: Actually create the Concat node ===
+    common::count(common::Counter::CONCAT_NODE);
     return std::make_shared<DocImpl>(Concat{ .left = std::move(left), .right = std::move(right) });
 }
 
@@ -1,6 +1,8 @@
 #ifndef EMIT_DOC_IMPL_HPP
 #define EMIT_DOC_IMPL_HPP
 
+#include "common/counters.hpp"
+
 #include <concepts>
 #include <memory>
 #include <string>
@@ -212,6 +214,7 @@ struct DocImpl
 template<typename Fn>
 auto transformImpl(const DocPtr &doc, Fn &&fn) -> DocPtr
 {
+    common::count(common::Counter::TRANSFORM_NODES);
     return std::visit(
       [&fn](const DocNode auto &node) -> DocPtr {
           const auto mapped
@@ -227,6 +230,7 @@ auto foldImpl(const DocPtr &doc, T init, Fn &&fn) -> T
     if (!doc) {
         return init;
     }
+    common::count(common::Counter::FOLD_NODES);
 
     return std::visit(
       [&](const DocNode auto &node) -> T {
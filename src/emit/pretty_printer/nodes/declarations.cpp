@@ -5,6 +5,7 @@
 
 #include <ranges>
 #include <string>
+#include <string_view>
 
 namespace emit {
 
@@ -18,6 +19,7 @@ struct AlignmentLevel
 auto PrettyPrinter::operator()(const ast::GenericParam &node) const -> Doc
 {
     const std::string names = node.names
+                            | std::views::transform(&ast::Symbol::view)
                             | std::views::join_with(std::string_view{ ", " })
                             | std::ranges::to<std::string>();
 
@@ -39,6 +41,7 @@ auto PrettyPrinter::operator()(const ast::GenericParam &node) const -> Doc
 auto PrettyPrinter::operator()(const ast::Port &node) const -> Doc
 {
     const std::string names = node.names
+                            | std::views::transform(&ast::Symbol::view)
                             | std::views::join_with(std::string_view{ ", " })
                             | std::ranges::to<std::string>();
 
@@ -2,9 +2,11 @@
 
 #include "emit/pretty_printer.hpp"
 #include "emit/pretty_printer/doc.hpp"
+#include "emit/pretty_printer/doc_utils.hpp"
 
 #include <algorithm>
 #include <ranges>
+#include <string_view>
 
 namespace emit {
 
@@ -65,4 +67,19 @@ auto PrettyPrinter::operator()(const ast::Architecture &node) const -> Doc
     return result / end_line;
 }
 
+auto PrettyPrinter::operator()(const ast::RawUnit &node) const -> Doc
+{
+    // Texts must not contain newlines, so the source is re-joined line by line; a CRLF line
+    // ending loses its '\r' so the unit matches the line endings of the formatted ones
+    const auto lines = toDocVector(node.text | std::views::split('\n'), [](const auto &line) {
+        std::string_view text{ line };
+        if (text.ends_with('\r')) {
+            text.remove_suffix(1);
+        }
+        return Doc::text(text);
+    });
+
+    return joinDocs(lines, Doc::hardline(), false);
+}
+
 } // namespace emit
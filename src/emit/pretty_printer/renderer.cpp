@@ -1,25 +1,35 @@
 #include "emit/pretty_printer/renderer.hpp"
 
 #include "common/config.hpp"
+#include "common/counters.hpp"
 #include "common/overload.hpp"
+#include "common/stats.hpp"
+#include "common/trace.hpp"
 #include "emit/pretty_printer/doc_impl.hpp"
 
+#include <optional>
 #include <string>
 #include <variant>
 
 namespace emit {
 
-Renderer::Renderer(const common::Config &config) :
+Renderer::Renderer(const common::Config &config) : Renderer(config, nullptr) {}
+
+Renderer::Renderer(const common::Config &config, common::PipelineStats *stats) :
   width_(config.line_config.line_length),
   indent_size_(config.line_config.indent_size),
-  align_(config.port_map.align_signals)
+  align_(config.port_map.align_signals),
+  stats_(stats)
 {
 }
 
 auto Renderer::render(const DocPtr &doc) -> std::string
 {
+    const common::TraceSpan span("render");
+
     output_.clear();
     column_ = 0;
+    group_depth_ = 0;
 
     renderDoc(0, Mode::BREAK, doc);
 
@@ -72,6 +82,7 @@ void Renderer::renderDoc(int indent, Mode mode, const DocPtr &doc)
             DocPtr doc_to_render = node.doc;
             if (align_) {
                 // Run the two-pass logic to resolve alignment
+                const common::PhaseTimer timer(stats_, common::Phase::ALIGN);
                 doc_to_render = resolveAlignment(node.doc);
             }
 
@@ -84,6 +95,13 @@ void Renderer::renderDoc(int indent, Mode mode, const DocPtr &doc)
 
         // Union (decision point)
         [&](const Union &node) -> void {
+            // Each top-level group is traced on its own to spot expensive layouts
+            std::optional<common::TraceSpan> span{};
+            if (group_depth_ == 0) {
+                span.emplace("render group");
+            }
+            ++group_depth_;
+
             // Decide: use flat or broken layout?
             if (mode == Mode::FLAT || fits(width_ - column_, node.flat)) {
                 // Fits on current line - use flat version
@@ -92,6 +110,8 @@ void Renderer::renderDoc(int indent, Mode mode, const DocPtr &doc)
                 // Doesn't fit - use broken version
                 renderDoc(indent, Mode::BREAK, node.broken);
             }
+
+            --group_depth_;
         }
     };
 
@@ -100,12 +120,14 @@ void Renderer::renderDoc(int indent, Mode mode, const DocPtr &doc)
 // Check if document fits on current line
 auto Renderer::fits(int width, const DocPtr &doc) -> bool
 {
+    common::count(common::Counter::FITS_CALLS);
     return fitsImpl(width, doc) >= 0;
 }
 
 // Helper: simulate flattened rendering and return remaining width
 auto Renderer::fitsImpl(int width, const DocPtr &doc) -> int
 {
+    common::count(common::Counter::FITS_NODES);
     if (!doc) {
         return width;
     }
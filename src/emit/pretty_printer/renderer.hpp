@@ -9,6 +9,7 @@
 
 namespace common {
 struct Config;
+struct PipelineStats;
 } // namespace common
 
 namespace emit {
@@ -26,6 +27,9 @@ class Renderer final
   public:
     explicit Renderer(const common::Config &config);
 
+    /// Renderer that adds the time spent resolving alignment to `stats`, if not null
+    Renderer(const common::Config &config, common::PipelineStats *stats);
+
     // Core rendering function
     auto render(const DocPtr &doc) -> std::string;
 
@@ -48,7 +52,9 @@ class Renderer final
     int indent_size_{};
     bool align_{ false };
     int column_{ 0 };
+    int group_depth_{ 0 }; ///< Groups (unions) currently being rendered
     std::string output_;
+    common::PipelineStats *stats_{ nullptr };
 };
 
 } // namespace emit
@@ -47,11 +47,12 @@ auto printTrailingTriviaList(const std::span<const ast::Trivia> list) -> Doc
 
 auto PrettyPrinter::withTrivia(const ast::NodeBase &node, Doc core_doc) -> Doc
 {
-    if (!node.trivia) {
+    const auto *const node_trivia = node.trivia.get();
+    if (node_trivia == nullptr) {
         return core_doc;
     }
 
-    const auto &trivia = *node.trivia;
+    const auto &trivia = *node_trivia;
 
     const Doc leading = std::ranges::fold_left(
       trivia.leading | std::views::transform(printTrivia), Doc::empty(), std::plus<>());
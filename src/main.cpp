@@ -1,33 +1,99 @@
 #include "ast/nodes/design_file.hpp"
 #include "builder/ast_builder.hpp"
+#include "builder/parser_profile.hpp"
 #include "cli/argument_parser.hpp"
 #include "cli/config_reader.hpp"
+#include "cli/stats_report.hpp"
+#include "common/counters_dump.hpp" // NOLINT(misc-include-cleaner): dumps at exit
+#include "common/stats.hpp"
+#include "common/trace.hpp"
 #include "emit/pretty_printer.hpp"
+#include "emit/pretty_printer/doc_impl.hpp"
 
 #include <cstddef>
 #include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <iostream>
 #include <span>
+#include <stdexcept>
+#include <string>
 
 auto main(int argc, char *argv[]) -> int
 {
     try {
-        const cli::ArgumentParser argparser{
-            std::span<const char *const>{ argv, static_cast<std::size_t>(argc) }
-        };
+        // Always timed: whether statistics are wanted is only known once the arguments are parsed
+        common::PipelineStats stats{};
+        const auto argparser = [&] {
+            const common::PhaseTimer timer(&stats, common::Phase::ARGS);
+            return cli::ArgumentParser{
+                std::span<const char *const>{ argv, static_cast<std::size_t>(argc) }
+            };
+        }();
+
+        const auto &trace_path = argparser.getTracePath();
+        if (trace_path) {
+            common::Tracer::instance().enable();
+        }
 
-        cli::ConfigReader config_reader{ argparser.getConfigPath() };
-        const auto config_result = config_reader.readConfigFile();
+        const bool stats_json = argparser.isFlagSet(cli::ArgumentFlag::STATS_JSON);
+        const bool show_stats = stats_json || argparser.isFlagSet(cli::ArgumentFlag::STATS);
+        stats.file = argparser.getInputPath().string();
+        auto *const stats_ptr = show_stats ? &stats : nullptr;
+
+        const auto config_result = [&] {
+            const common::PhaseTimer timer(stats_ptr, common::Phase::CONFIG);
+            cli::ConfigReader config_reader{ argparser.getConfigPath() };
+            return config_reader.readConfigFile();
+        }();
         const auto &config = config_result.value();
 
-        // Build AST from input file
-        const ast::DesignFile root = builder::buildFromFile(argparser.getInputPath());
+        // Build AST from input file; a check run only needs the first syntax error
+        builder::ParserProfile profile{};
+        const bool profile_parser = argparser.isFlagSet(cli::ArgumentFlag::PROFILE_PARSER);
+        const builder::BuildOptions build_options{
+            .fail_fast = argparser.isFlagSet(cli::ArgumentFlag::CHECK),
+            .resilient = argparser.isFlagSet(cli::ArgumentFlag::RESILIENT),
+            .profile = profile_parser ? &profile : nullptr,
+            .stats = stats_ptr,
+        };
+        const ast::DesignFile root = [&] {
+            const common::TraceSpan span("build AST");
+            return builder::buildFromFile(argparser.getInputPath(), build_options);
+        }();
+
+        if (profile_parser) {
+            std::cerr << builder::formatProfile(profile);
+        }
 
         // Pretty print the AST
         const emit::PrettyPrinter printer{};
-        const auto doc = printer.visit(root);
-        std::cout << doc.render(config);
+        const auto doc = [&] {
+            const common::PhaseTimer timer(stats_ptr, common::Phase::DOC_BUILD);
+            const common::TraceSpan span("doc build");
+            return printer.visit(root);
+        }();
+        if (show_stats) {
+            stats.sampleMemory(common::Phase::DOC_BUILD);
+        }
+        std::cout << doc.render(config, stats_ptr);
+
+        if (show_stats) {
+            stats.doc_nodes
+              = doc.fold(std::size_t{ 0 }, [](std::size_t count, const auto & /*node*/) {
+                    return count + 1;
+                });
+            const std::span<const common::PipelineStats> files{ &stats, 1 };
+            std::cerr << (stats_json ? cli::formatStatsJson(files) : cli::formatStats(files));
+        }
+
+        if (trace_path) {
+            std::ofstream trace_file{ *trace_path };
+            if (!trace_file) {
+                throw std::runtime_error("Failed to open trace file: " + trace_path->string());
+            }
+            trace_file << common::Tracer::instance().toJson();
+        }
 
     } catch (const std::exception &e) {
         std::cerr << "Error: " << e.what() << '\n';
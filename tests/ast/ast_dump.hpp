@@ -0,0 +1,374 @@
+#ifndef TESTS_AST_DUMP_HPP
+#define TESTS_AST_DUMP_HPP
+
+#include "ast/node.hpp"
+#include "ast/nodes/declarations.hpp"
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "ast/nodes/expressions.hpp"
+#include "ast/nodes/statements.hpp"
+#include "ast/symbol.hpp"
+
+#include <cstddef>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace test_utils {
+
+/// @brief Writes every field of an AST, trivia included, as an indented tree.
+///
+/// Unlike the printer output this also covers nodes whose printers are still stubs, so two
+/// front-ends can be compared node by node.
+class AstDumper final
+{
+  public:
+    [[nodiscard]]
+    auto dump(const ast::DesignFile &file) -> std::string
+    {
+        out_.clear();
+        node("DesignFile", file, [&] { list("units", file.units); });
+        return std::move(out_);
+    }
+
+  private:
+    std::string out_;
+    int depth_{ 0 };
+
+    void line(const std::string_view text)
+    {
+        out_.append(static_cast<std::size_t>(depth_) * 2, ' ');
+        out_ += text;
+        out_ += '\n';
+    }
+
+    void field(const std::string_view name, const std::string_view value)
+    {
+        line(std::format("{}: '{}'", name, value));
+    }
+
+    void field(const std::string_view name, const bool value)
+    {
+        line(std::format("{}: {}", name, value));
+    }
+
+    void field(const std::string_view name, const std::vector<ast::Symbol> &symbols)
+    {
+        std::string joined{};
+        for (const auto &symbol : symbols) {
+            joined += std::format("'{}' ", symbol.view());
+        }
+        line(std::format("{}: [ {}]", name, joined));
+    }
+
+    void optionalField(const std::string_view name, const std::optional<std::string> &value)
+    {
+        line(value ? std::format("{}: '{}'", name, *value) : std::format("{}: none", name));
+    }
+
+    /// @brief A labelled child block, indented one level
+    void nested(const std::string_view label, const auto &body)
+    {
+        line(std::format("{}:", label));
+        ++depth_;
+        body();
+        --depth_;
+    }
+
+    /// @brief A node header, its trivia and its fields
+    void node(const std::string_view kind, const ast::NodeBase &base, const auto &body)
+    {
+        nested(kind, [&] {
+            trivia(base.trivia);
+            body();
+        });
+    }
+
+    void trivia(const ast::SparseTrivia &slot)
+    {
+        const auto *const node_trivia = slot.get();
+        if (node_trivia == nullptr) {
+            return;
+        }
+        const auto items = [&](const std::string_view label, const std::vector<ast::Trivia> &tv) {
+            for (const auto &item : tv) {
+                if (const auto *comment = std::get_if<ast::Comment>(&item)) {
+                    line(std::format("{} comment '{}'", label, comment->text));
+                } else {
+                    line(std::format(
+                      "{} break {}", label, std::get<ast::ParagraphBreak>(item).blank_lines));
+                }
+            }
+        };
+        items("leading", node_trivia->leading);
+        items("trailing", node_trivia->trailing);
+        if (node_trivia->inline_comment) {
+            line(std::format("inline comment '{}'", node_trivia->inline_comment->text));
+        }
+    }
+
+    template<typename... Ts>
+    void visit(const std::variant<Ts...> &value)
+    {
+        std::visit([this](const auto &alternative) { visit(alternative); }, value);
+    }
+
+    template<typename T>
+    void visit(const ast::Box<T> &value)
+    {
+        if (value == nullptr) {
+            line("null");
+            return;
+        }
+        visit(*value);
+    }
+
+    template<typename T>
+    void child(const std::string_view label, const T &value)
+    {
+        nested(label, [&] { visit(value); });
+    }
+
+    template<typename T>
+    void child(const std::string_view label, const std::optional<T> &value)
+    {
+        if (!value) {
+            line(std::format("{}: none", label));
+            return;
+        }
+        child(label, *value);
+    }
+
+    template<typename T>
+    void list(const std::string_view label, const std::vector<T> &values)
+    {
+        nested(std::format("{} ({})", label, values.size()), [&] {
+            for (const auto &value : values) {
+                visit(value);
+            }
+        });
+    }
+
+    // ---------------------- Design units ----------------------
+
+    void visit(const ast::Entity &entity)
+    {
+        node("Entity", entity, [&] {
+            field("name", entity.name);
+            node("GenericClause", entity.generic_clause, [&] {
+                list("generics", entity.generic_clause.generics);
+            });
+            node("PortClause", entity.port_clause, [&] {
+                list("ports", entity.port_clause.ports);
+            });
+            list("decls", entity.decls);
+            list("stmts", entity.stmts);
+            optionalField("end_label", entity.end_label);
+        });
+    }
+
+    void visit(const ast::Architecture &arch)
+    {
+        node("Architecture", arch, [&] {
+            field("name", arch.name);
+            field("entity_name", arch.entity_name);
+            list("decls", arch.decls);
+            list("stmts", arch.stmts);
+        });
+    }
+
+    void visit(const ast::RawUnit &raw)
+    {
+        node("RawUnit", raw, [&] { field("text", raw.text); });
+    }
+
+    // ---------------------- Declarations ----------------------
+
+    void visit(const ast::ConstantDecl &decl)
+    {
+        node("ConstantDecl", decl, [&] {
+            field("names", decl.names);
+            field("type_name", decl.type_name);
+            child("init_expr", decl.init_expr);
+        });
+    }
+
+    void visit(const ast::SignalDecl &decl)
+    {
+        node("SignalDecl", decl, [&] {
+            field("names", decl.names);
+            field("type_name", decl.type_name);
+            field("has_bus_kw", decl.has_bus_kw);
+            child("constraint", decl.constraint);
+            child("init_expr", decl.init_expr);
+        });
+    }
+
+    void visit(const ast::GenericParam &param)
+    {
+        node("GenericParam", param, [&] {
+            field("names", param.names);
+            field("type_name", param.type_name);
+            child("default_expr", param.default_expr);
+            field("is_last", param.is_last);
+        });
+    }
+
+    void visit(const ast::Port &port)
+    {
+        node("Port", port, [&] {
+            field("names", port.names);
+            field("mode", port.mode);
+            field("type_name", port.type_name);
+            child("default_expr", port.default_expr);
+            child("constraint", port.constraint);
+            field("is_last", port.is_last);
+        });
+    }
+
+    // ---------------------- Expressions ----------------------
+
+    void visit(const ast::TokenExpr &expr)
+    {
+        node("TokenExpr", expr, [&] { field("text", expr.text); });
+    }
+
+    void visit(const ast::GroupExpr &expr)
+    {
+        node("GroupExpr", expr, [&] { list("children", expr.children); });
+    }
+
+    void visit(const ast::UnaryExpr &expr)
+    {
+        node("UnaryExpr", expr, [&] {
+            field("op", expr.op);
+            child("value", expr.value);
+        });
+    }
+
+    void visit(const ast::BinaryExpr &expr)
+    {
+        node("BinaryExpr", expr, [&] {
+            child("left", expr.left);
+            field("op", expr.op);
+            child("right", expr.right);
+        });
+    }
+
+    void visit(const ast::ParenExpr &expr)
+    {
+        node("ParenExpr", expr, [&] { child("inner", expr.inner); });
+    }
+
+    void visit(const ast::CallExpr &expr)
+    {
+        node("CallExpr", expr, [&] {
+            child("callee", expr.callee);
+            child("args", expr.args);
+        });
+    }
+
+    void visit(const ast::IndexConstraint &constraint)
+    {
+        node("IndexConstraint", constraint, [&] { child("ranges", constraint.ranges); });
+    }
+
+    void visit(const ast::RangeConstraint &constraint)
+    {
+        node("RangeConstraint", constraint, [&] { child("range", constraint.range); });
+    }
+
+    // ---------------------- Statements ----------------------
+
+    void visit(const ast::ConcurrentAssign &stmt)
+    {
+        node("ConcurrentAssign", stmt, [&] {
+            child("target", stmt.target);
+            child("value", stmt.value);
+        });
+    }
+
+    void visit(const ast::SequentialAssign &stmt)
+    {
+        node("SequentialAssign", stmt, [&] {
+            child("target", stmt.target);
+            child("value", stmt.value);
+        });
+    }
+
+    void visit(const ast::IfStatement::Branch &branch)
+    {
+        nested("Branch", [&] {
+            trivia(branch.trivia);
+            child("condition", branch.condition);
+            list("body", branch.body);
+        });
+    }
+
+    void visit(const ast::IfStatement &stmt)
+    {
+        node("IfStatement", stmt, [&] {
+            child("if_branch", stmt.if_branch);
+            list("elsif_branches", stmt.elsif_branches);
+            child("else_branch", stmt.else_branch);
+        });
+    }
+
+    void visit(const ast::CaseStatement::WhenClause &clause)
+    {
+        nested("WhenClause", [&] {
+            trivia(clause.trivia);
+            list("choices", clause.choices);
+            list("body", clause.body);
+        });
+    }
+
+    void visit(const ast::CaseStatement &stmt)
+    {
+        node("CaseStatement", stmt, [&] {
+            child("selector", stmt.selector);
+            list("when_clauses", stmt.when_clauses);
+        });
+    }
+
+    void visit(const ast::Process &process)
+    {
+        node("Process", process, [&] {
+            optionalField("label", process.label);
+            field("sensitivity_list", process.sensitivity_list);
+            list("body", process.body);
+        });
+    }
+
+    void visit(const ast::ForLoop &loop)
+    {
+        node("ForLoop", loop, [&] {
+            field("iterator", loop.iterator);
+            child("range", loop.range);
+            list("body", loop.body);
+        });
+    }
+
+    void visit(const ast::WhileLoop &loop)
+    {
+        node("WhileLoop", loop, [&] {
+            child("condition", loop.condition);
+            list("body", loop.body);
+        });
+    }
+};
+
+/// @brief The whole AST as text, for comparing two builds of the same source
+[[nodiscard]]
+inline auto dumpAst(const ast::DesignFile &file) -> std::string
+{
+    return AstDumper{}.dump(file);
+}
+
+} // namespace test_utils
+
+#endif /* TESTS_AST_DUMP_HPP */
@@ -0,0 +1,156 @@
+#include "ast/ast_dump.hpp"
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "builder/ast_builder.hpp"
+#include "builder/fast_parser.hpp"
+#include "common/config.hpp"
+#include "emit/pretty_printer.hpp"
+#include "vhdlLexer.h"
+
+#include <ANTLRInputStream.h>
+#include <CommonTokenStream.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace {
+
+constexpr builder::BuildOptions ANTLR_ONLY{ .frontend = builder::Frontend::ANTLR };
+
+auto render(const ast::DesignFile &design) -> std::string
+{
+    const emit::PrettyPrinter printer{};
+    return printer.visit(design).render(common::Config{});
+}
+
+auto parsesWithFastParser(std::string_view vhdl_code) -> bool
+{
+    antlr4::ANTLRInputStream input(vhdl_code);
+    vhdlLexer lexer(&input);
+    antlr4::CommonTokenStream tokens(&lexer);
+    tokens.fill();
+
+    builder::FastParser parser(tokens);
+    return parser.parseDesignFile().has_value();
+}
+
+} // namespace
+
+TEST_CASE("FastParser matches the ANTLR front-end on test data", "[builder][fast_parser]")
+{
+    const auto file = GENERATE(as<std::string>{}, "simple.vhd", "comments.vhd", "ports.vhd");
+    const auto path = std::filesystem::path{ TEST_DATA_DIR } / "vhdl" / file;
+
+    const auto fast = builder::buildFromFile(path);
+    const auto reference = builder::buildFromFile(path, ANTLR_ONLY);
+
+    REQUIRE(test_utils::dumpAst(fast) == test_utils::dumpAst(reference));
+    REQUIRE(render(fast) == render(reference));
+}
+
+TEST_CASE("FastParser handles the supported subset", "[builder][fast_parser]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        library ieee;
+        use ieee.std_logic_1164.all;
+
+        -- Counter entity
+        entity counter is
+            generic (WIDTH : integer := 8);  -- bus width
+            port (
+                clk : in std_logic;
+                q   : out std_logic_vector(WIDTH - 1 downto 0)
+            );
+        end entity counter;
+
+        architecture rtl of counter is
+            constant MAX : integer := 2 ** WIDTH;
+            signal count : unsigned(WIDTH - 1 downto 0) := (others => '0');
+        begin
+            -- Main process
+            tick : process (clk) is
+                variable tmp : integer := 0;
+            begin
+                if rising_edge(clk) then
+                    case count(1 downto 0) is
+                        when "00" | "01" => count <= count + 1;
+                        when others => null;
+                    end case;
+                elsif not enable then
+                    tmp := abs tmp;  -- keep
+                end if;
+                for i in 0 to 3 loop
+                    wait for 10 ns;
+                end loop;
+            end process tick;
+
+            q <= std_logic_vector(count) when enable = '1' else (others => 'Z');
+        end architecture rtl;
+    )";
+
+    REQUIRE(parsesWithFastParser(VHDL_FILE));
+
+    const auto fast = builder::buildFromString(VHDL_FILE);
+    const auto reference = builder::buildFromString(VHDL_FILE, ANTLR_ONLY);
+
+    REQUIRE(fast.units.size() == 2);
+
+    // Declarations and process bodies print as stubs, so only the AST itself covers them
+    const auto dump = test_utils::dumpAst(fast);
+    REQUIRE(dump == test_utils::dumpAst(reference));
+    REQUIRE(dump.contains("sensitivity_list: [ 'clk' ]"));
+    REQUIRE(dump.contains("when_clauses (2):"));
+    REQUIRE(dump.contains("ForLoop:"));
+    REQUIRE(render(fast) == render(reference));
+}
+
+TEST_CASE("FastParser falls back to ANTLR for unsupported constructs", "[builder][fast_parser]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        package pkg is
+            constant C : integer := 1;
+        end package pkg;
+
+        entity top is
+            port (a : in bit);
+        end top;
+
+        architecture rtl of top is
+        begin
+            u0 : entity work.leaf port map (a => a);
+        end rtl;
+    )";
+
+    REQUIRE_FALSE(parsesWithFastParser(VHDL_FILE));
+
+    const auto fast = builder::buildFromString(VHDL_FILE);
+    const auto reference = builder::buildFromString(VHDL_FILE, ANTLR_ONLY);
+
+    REQUIRE(fast.units.size() == 2);
+    REQUIRE(std::holds_alternative<ast::Entity>(fast.units.front()));
+    REQUIRE(test_utils::dumpAst(fast) == test_utils::dumpAst(reference));
+    REQUIRE(render(fast) == render(reference));
+}
+
+TEST_CASE("FastParser folds operator chains like the Translator", "[builder][fast_parser]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        architecture rtl of top is
+        begin
+            y <= a + b + c;  -- chain
+            z <= -a * b - c & d and e or f;
+            w <= (a sll 2) = b ** 2 xor not c;
+        end rtl;
+    )";
+
+    REQUIRE(parsesWithFastParser(VHDL_FILE));
+
+    const auto fast = builder::buildFromString(VHDL_FILE);
+    const auto reference = builder::buildFromString(VHDL_FILE, ANTLR_ONLY);
+
+    REQUIRE(test_utils::dumpAst(fast) == test_utils::dumpAst(reference));
+    REQUIRE(render(fast) == render(reference));
+}
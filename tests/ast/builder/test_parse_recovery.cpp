@@ -0,0 +1,100 @@
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "builder/ast_builder.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <stdexcept>
+#include <string_view>
+#include <variant>
+
+namespace {
+
+constexpr builder::BuildOptions FAIL_FAST{
+    .frontend = builder::Frontend::ANTLR,
+    .fail_fast = true,
+};
+
+} // namespace
+
+TEST_CASE("Fail-fast parsing accepts valid input", "[builder][recovery]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        entity a is
+        end a;
+
+        architecture rtl of a is
+        begin
+        end rtl;
+    )";
+
+    const auto design = builder::buildFromString(VHDL_FILE, FAIL_FAST);
+    REQUIRE(design.units.size() == 2);
+}
+
+TEST_CASE("Fail-fast parsing reports the offending token", "[builder][recovery]")
+{
+    constexpr std::string_view VHDL_FILE = "entity a is\nend a;\n\nentity b is\n  port (x : in );\nend b;\n";
+
+    REQUIRE_THROWS_WITH(builder::buildFromString(VHDL_FILE, FAIL_FAST),
+                        Catch::Matchers::StartsWith("Syntax error at line 5:"));
+}
+
+TEST_CASE("Resilient parsing keeps a broken unit verbatim", "[builder][recovery]")
+{
+    constexpr builder::BuildOptions RESILIENT{ .resilient = true };
+    constexpr std::string_view VHDL_FILE = R"(entity a is
+end a;
+
+entity b is
+  port (x : in );
+end b;
+
+library ieee;
+use ieee.std_logic_1164.all;
+
+architecture rtl of a is
+begin
+end rtl;
+)";
+
+    const auto design = builder::buildFromString(VHDL_FILE, RESILIENT);
+
+    REQUIRE(design.units.size() == 3);
+    REQUIRE(std::holds_alternative<ast::Entity>(design.units[0]));
+    REQUIRE(std::holds_alternative<ast::Architecture>(design.units[2]));
+
+    const auto &raw = std::get<ast::RawUnit>(design.units[1]);
+    REQUIRE(raw.text == "entity b is\n  port (x : in );\nend b;");
+}
+
+TEST_CASE("Resilient parsing keeps a broken unit's own context clauses with it",
+          "[builder][recovery]")
+{
+    constexpr builder::BuildOptions RESILIENT{ .resilient = true };
+    constexpr std::string_view VHDL_FILE = R"(entity a is
+end a;
+
+library ieee;
+use ieee.std_logic_1164.all;
+
+entity b is
+  port (x : in );
+end b;
+
+architecture rtl of a is
+begin
+end rtl;
+)";
+
+    const auto design = builder::buildFromString(VHDL_FILE, RESILIENT);
+
+    REQUIRE(design.units.size() == 3);
+    REQUIRE(std::holds_alternative<ast::Entity>(design.units[0]));
+    REQUIRE(std::holds_alternative<ast::Architecture>(design.units[2]));
+
+    const auto &raw = std::get<ast::RawUnit>(design.units[1]);
+    REQUIRE(raw.text
+            == "library ieee;\nuse ieee.std_logic_1164.all;\n\n"
+               "entity b is\n  port (x : in );\nend b;");
+}
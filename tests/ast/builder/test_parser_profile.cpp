@@ -0,0 +1,25 @@
+#include "builder/ast_builder.hpp"
+#include "builder/parser_profile.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <filesystem>
+
+TEST_CASE("Parser profiling reports the invoked decisions", "[builder][profile]")
+{
+    const auto path = std::filesystem::path{ TEST_DATA_DIR } / "vhdl" / "simple.vhd";
+
+    builder::ParserProfile profile{};
+    const auto design = builder::buildFromFile(path, builder::BuildOptions{ .profile = &profile });
+
+    REQUIRE_FALSE(design.units.empty());
+    REQUIRE_FALSE(profile.decisions.empty());
+    REQUIRE(std::ranges::all_of(profile.decisions, [](const auto &entry) {
+        return entry.invocations > 0 && !entry.rule.empty();
+    }));
+    REQUIRE(std::ranges::is_sorted(
+      profile.decisions, std::ranges::greater{}, &builder::DecisionProfile::time_ns));
+
+    REQUIRE_THAT(builder::formatProfile(profile), Catch::Matchers::StartsWith("rule"));
+}
@@ -0,0 +1,64 @@
+#include "ast/nodes/design_file.hpp"
+#include "ast/nodes/design_units.hpp"
+#include "builder/ast_builder.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <string_view>
+#include <variant>
+
+TEST_CASE("Session builds several inputs in a row", "[builder][session]")
+{
+    constexpr std::string_view FIRST = "entity first is end first;\n";
+    constexpr std::string_view SECOND = R"(
+        entity second is
+            port (clk : in std_logic);
+        end second;
+
+        architecture rtl of second is
+        begin
+        end rtl;
+    )";
+
+    builder::Session session{};
+
+    const auto first = session.buildFromString(FIRST);
+    const auto second = session.buildFromString(SECOND);
+
+    REQUIRE(first.units.size() == 1);
+    REQUIRE(std::get<ast::Entity>(first.units[0]).name == "first");
+
+    REQUIRE(second.units.size() == 2);
+    const auto &entity = std::get<ast::Entity>(second.units[0]);
+    REQUIRE(entity.name == "second");
+    REQUIRE(entity.port_clause.ports.size() == 1);
+}
+
+TEST_CASE("Session recovers after a failed build", "[builder][session]")
+{
+    constexpr builder::BuildOptions FAIL_FAST{
+        .frontend = builder::Frontend::ANTLR,
+        .fail_fast = true,
+    };
+
+    builder::Session session{};
+
+    REQUIRE_THROWS(session.buildFromString("entity a is\n  port (x : in );\nend a;\n", FAIL_FAST));
+
+    const auto design = session.buildFromString("entity b is end b;\n", FAIL_FAST);
+    REQUIRE(design.units.size() == 1);
+    REQUIRE(std::get<ast::Entity>(design.units[0]).name == "b");
+}
+
+TEST_CASE("Session matches one-shot builds on test files", "[builder][session]")
+{
+    const auto path = std::filesystem::path{ TEST_DATA_DIR } / "vhdl" / "simple.vhd";
+
+    builder::Session session{};
+    const auto warm_up = session.buildFromFile(path);
+    const auto reused = session.buildFromFile(path);
+    const auto fresh = builder::buildFromFile(path);
+
+    REQUIRE(reused.units.size() == fresh.units.size());
+    REQUIRE(warm_up.units.size() == fresh.units.size());
+}
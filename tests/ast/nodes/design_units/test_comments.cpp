@@ -261,3 +261,22 @@ TEST_CASE("Generic captures paragraph breaks after comments with 2 blank lines",
         REQUIRE(two_trivia.leading.empty());
     }
 }
+
+TEST_CASE("Nodes without comments or blank lines carry no trivia", "[design_units][comments]")
+{
+    constexpr std::string_view VHDL_FILE = R"(entity Example is
+    generic (
+        WIDTH : integer := 8;
+        DEPTH : integer := 16   -- Inline for DEPTH
+    );
+end Example;
+)";
+
+    auto design = builder::buildFromString(VHDL_FILE);
+    auto *entity = std::get_if<ast::Entity>(design.units.data());
+    REQUIRE(entity != nullptr);
+    REQUIRE(entity->generic_clause.generics.size() == 2);
+
+    REQUIRE_FALSE(entity->generic_clause.generics[0].trivia.has_value());
+    REQUIRE(entity->generic_clause.generics[1].trivia.has_value());
+}
@@ -112,3 +112,53 @@ TEST_CASE("BinaryExpr: Concatenation operator", "[expressions][binary]")
     REQUIRE(binary != nullptr);
     REQUIRE(binary->op == "&");
 }
+
+TEST_CASE("BinaryExpr: Operator chains fold to the left", "[expressions][binary]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        entity E is end E;
+        architecture A of E is
+            signal x : integer := a - b + c;
+        begin
+        end A;
+    )";
+
+    auto design = builder::buildFromString(VHDL_FILE);
+    const auto *expr = getSignalInitExpr(design);
+    REQUIRE(expr != nullptr);
+
+    const auto *outer = std::get_if<ast::BinaryExpr>(expr);
+    REQUIRE(outer != nullptr);
+    REQUIRE(outer->op == "+");
+
+    const auto *inner = std::get_if<ast::BinaryExpr>(outer->left.get());
+    REQUIRE(inner != nullptr);
+    REQUIRE(inner->op == "-");
+
+    auto *right = std::get_if<ast::TokenExpr>(outer->right.get());
+    REQUIRE(right != nullptr);
+    REQUIRE(right->text == "c");
+}
+
+TEST_CASE("BinaryExpr: Sign covers only the first term of a chain", "[expressions][binary]")
+{
+    constexpr std::string_view VHDL_FILE = R"(
+        entity E is end E;
+        architecture A of E is
+            signal x : integer := -a + b;
+        begin
+        end A;
+    )";
+
+    auto design = builder::buildFromString(VHDL_FILE);
+    const auto *expr = getSignalInitExpr(design);
+    REQUIRE(expr != nullptr);
+
+    const auto *add = std::get_if<ast::BinaryExpr>(expr);
+    REQUIRE(add != nullptr);
+    REQUIRE(add->op == "+");
+
+    const auto *neg = std::get_if<ast::UnaryExpr>(add->left.get());
+    REQUIRE(neg != nullptr);
+    REQUIRE(neg->op == "-");
+}
@@ -0,0 +1,73 @@
+#include "ast/symbol.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+TEST_CASE("Symbol interns each spelling once", "[ast][symbol]")
+{
+    const ast::Symbol first{ "data_valid" };
+    const ast::Symbol second{ std::string{ "data_valid" } };
+
+    REQUIRE(first == second);
+    REQUIRE(first.id() == second.id());
+    REQUIRE(first.view() == "data_valid");
+    REQUIRE(ast::Symbol{}.empty());
+}
+
+TEST_CASE("Symbol keeps the original case and a folded key", "[ast][symbol]")
+{
+    const ast::Symbol upper{ "CLK_In" };
+    const ast::Symbol lower{ "clk_in" };
+
+    REQUIRE(upper != lower);
+    REQUIRE(upper.view() == "CLK_In");
+    REQUIRE(upper.folded() == lower);
+    REQUIRE(upper.equalsFolded(lower));
+}
+
+TEST_CASE("Symbol keeps extended identifiers case-sensitive", "[ast][symbol]")
+{
+    const ast::Symbol extended{ "\\Bus\\" };
+
+    REQUIRE(extended.folded() == extended);
+    REQUIRE_FALSE(extended.equalsFolded(ast::Symbol{ "\\bus\\" }));
+}
+
+TEST_CASE("Symbol does not fold literals", "[ast][symbol]")
+{
+    const ast::Symbol upper{ "'A'" };
+    const ast::Symbol lower{ "'a'" };
+
+    REQUIRE(upper.folded() == upper);
+    REQUIRE_FALSE(upper.equalsFolded(lower));
+    REQUIRE(ast::Symbol{ "X\"FF\"" }.folded() != ast::Symbol{ "x\"ff\"" });
+}
+
+TEST_CASE("Symbol tables are per thread and can be cleared", "[ast][symbol]")
+{
+    auto &table = ast::SymbolTable::local();
+    const auto generation = table.generation();
+    const auto size_with_name = [&] {
+        const ast::Symbol name{ "only_on_main_thread" };
+        return table.size();
+    }();
+
+    std::size_t other_size{};
+    std::uint32_t other_generation{};
+    std::thread{ [&] {
+        other_size = ast::SymbolTable::local().size();
+        other_generation = ast::SymbolTable::local().generation();
+    } }.join();
+    REQUIRE(other_size < size_with_name);
+    REQUIRE(other_generation != generation);
+
+    // No Symbol of the old generation is alive past this point
+    table.clear();
+    REQUIRE(table.size() == 1);
+    REQUIRE(table.generation() != generation);
+    REQUIRE(ast::Symbol{ "fresh" }.view() == "fresh");
+    REQUIRE(ast::Symbol{}.view().empty());
+}
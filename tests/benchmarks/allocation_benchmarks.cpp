@@ -0,0 +1,107 @@
+#include "benchmark_utils.hpp"
+#include "builder/ast_builder.hpp"
+#include "builder/translator.hpp"
+#include "common/config.hpp"
+#include "common/stats.hpp"
+#include "emit/pretty_printer.hpp"
+#include "nodes/design_file.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <string_view>
+
+namespace {
+
+constexpr std::size_t ITERATIONS = 20;
+
+struct AllocationReport final
+{
+    common::AllocationCount cold;   ///< First run, including one-time caches
+    common::AllocationCount steady; ///< Mean of the following runs
+};
+
+/// @brief Allocations made by `stage` on this thread; its result is destroyed inside the count
+auto countOnce(const auto &stage) -> common::AllocationCount
+{
+    const auto before = common::threadAllocations();
+    static_cast<void>(stage());
+    const auto &after = common::threadAllocations();
+    return { .count = after.count - before.count, .bytes = after.bytes - before.bytes };
+}
+
+auto measure(const auto &stage) -> AllocationReport
+{
+    AllocationReport report{ .cold = countOnce(stage), .steady = {} };
+    for (std::size_t i = 0; i < ITERATIONS; ++i) {
+        const auto run = countOnce(stage);
+        report.steady.count += run.count;
+        report.steady.bytes += run.bytes;
+    }
+    report.steady.count /= ITERATIONS;
+    report.steady.bytes /= ITERATIONS;
+    return report;
+}
+
+void printRow(const std::string_view stage, const AllocationReport &report)
+{
+    std::cout << std::format("{:<36} {:>12} {:>14} {:>12} {:>14}\n",
+                             stage,
+                             report.cold.count,
+                             report.cold.bytes,
+                             report.steady.count,
+                             report.steady.bytes);
+}
+
+} // namespace
+
+// Allocations do not depend on timing, so unlike the timed benchmarks these numbers are exact
+// and stable across runs and machines with the same standard library. Lives in its own
+// `vhdl_allocation_benchmarks` binary, the only benchmark program with the counting operator new.
+TEST_CASE("Allocations per stage", "[allocations]")
+{
+    const auto source = utils::STRESS_TEST_VHDL;
+    const common::Config default_config;
+
+    utils::ParsingContext context(source);
+    context.parse(false);
+
+    ast::DesignFile ast;
+    {
+        builder::Translator translator(*context.tokens);
+        translator.buildDesignFile(ast, context.tree);
+    }
+
+    const emit::PrettyPrinter printer{};
+    const auto doc = printer.visit(ast);
+
+    // Without the counting operator new every stage would report zero
+    REQUIRE(measure([] { return std::string_view{}.size(); }).steady.count == 0);
+    REQUIRE(measure([] { return std::make_unique<int>(); }).cold.count == 1);
+
+    std::cout << std::format("{:<36} {:>12} {:>14} {:>12} {:>14}\n",
+                             "stage",
+                             "cold allocs",
+                             "cold bytes",
+                             "allocs/iter",
+                             "bytes/iter");
+
+    printRow("End-to-End: buildFromString (SLL)",
+             measure([&] { return builder::buildFromString(source); }));
+    printRow("Internal: Parsing SLL",
+             measure([&] { return utils::benchmarkRawParse(source, true); }));
+    printRow("Internal: Parsing LL",
+             measure([&] { return utils::benchmarkRawParse(source, false); }));
+    printRow("Internal: AST Translation", measure([&] {
+                 ast::DesignFile root;
+                 builder::Translator translator(*context.tokens);
+                 translator.buildDesignFile(root, context.tree);
+                 return root;
+             }));
+    printRow("Internal: PrettyPrinter Visit", measure([&] { return printer.visit(ast); }));
+    printRow("Internal: PrettyPrinter Render",
+             measure([&] { return doc.render(default_config); }));
+}
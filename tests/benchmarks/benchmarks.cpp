@@ -2,6 +2,7 @@
 #include "builder/ast_builder.hpp"
 #include "builder/translator.hpp"
 #include "common/config.hpp"
+#include "common/counters_dump.hpp" // NOLINT(misc-include-cleaner): dumps at exit
 #include "emit/pretty_printer.hpp"
 #include "nodes/design_file.hpp"
 
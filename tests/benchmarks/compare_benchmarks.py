@@ -1,61 +1,183 @@
 #!/usr/bin/env python3
+"""Compare two Catch2 benchmark XML reports and optionally gate on regressions.
+
+Without options a table of means is printed. With --gate the script exits with
+status 1 when a benchmark regressed significantly, that is when both:
+
+  * its mean grew by more than the allowed percentage (per benchmark, see
+    --thresholds), and
+  * the bootstrapped confidence intervals of the two means do not overlap and
+    the difference is larger than --sigmas times the combined standard error,
+    so run-to-run noise alone does not fail the gate.
+
+A benchmark in the baseline that the new run lacks also fails the gate, since a
+renamed or dropped case would otherwise slip past it unnoticed; pass
+--allow-missing when that is intended.
+"""
 import xml.etree.ElementTree as ET
 import argparse
+import fnmatch
+import json
+import math
+import os
 import sys
 
+DEFAULT_THRESHOLD = 10.0  # percent
+DEFAULT_SIGMAS = 3.0
+
+
+class Result:
+    def __init__(self, mean, low, high, std_dev, samples):
+        self.mean = mean
+        self.low = low
+        self.high = high
+        self.std_dev = std_dev
+        self.samples = samples
+
+    def std_error(self):
+        return self.std_dev / math.sqrt(max(self.samples, 1))
+
+
 def parse_benchmarks(xml_file):
+    if not os.path.exists(xml_file):
+        print(f"Missing benchmark report {xml_file}; record a baseline with the "
+              f"benchmark_update_baseline target first")
+        sys.exit(2)
+
     try:
         tree = ET.parse(xml_file)
         root = tree.getroot()
     except Exception as e:
         print(f"Error parsing {xml_file}: {e}")
-        sys.exit(1)
+        sys.exit(2)
 
     benchmarks = {}
-    
+
     for result in root.iter('BenchmarkResults'):
         name = result.get('name')
         mean_elem = result.find('mean')
-        if mean_elem is not None:
-            val = float(mean_elem.get('value'))
-            benchmarks[name] = val
-            
+        if mean_elem is None:
+            continue
+
+        mean = float(mean_elem.get('value'))
+        std_elem = result.find('standardDeviation')
+        std_dev = float(std_elem.get('value')) if std_elem is not None else 0.0
+
+        benchmarks[name] = Result(
+            mean=mean,
+            low=float(mean_elem.get('lowerBound', mean)),
+            high=float(mean_elem.get('upperBound', mean)),
+            std_dev=std_dev,
+            samples=int(result.get('samples', 1)),
+        )
+
     return benchmarks
 
+
+def load_thresholds(path):
+    """Return (default, [(pattern, percent)]) from a JSON thresholds file."""
+    if path is None:
+        return DEFAULT_THRESHOLD, []
+
+    with open(path) as f:
+        data = json.load(f)
+
+    patterns = list(data.get('benchmarks', {}).items())
+    return float(data.get('default', DEFAULT_THRESHOLD)), patterns
+
+
+def threshold_for(name, default, patterns):
+    # Exact names win over patterns, then the first matching pattern
+    for pattern, percent in patterns:
+        if pattern == name:
+            return float(percent)
+    for pattern, percent in patterns:
+        if fnmatch.fnmatchcase(name, pattern):
+            return float(percent)
+    return default
+
+
+def classify(base, new, threshold, sigmas):
+    """Return 'regression', 'improvement' or '' for one benchmark."""
+    pct = (new.mean - base.mean) / base.mean * 100
+    diff = abs(new.mean - base.mean)
+    noise = sigmas * math.hypot(base.std_error(), new.std_error())
+
+    if pct > threshold and new.low > base.high and diff > noise:
+        return 'regression'
+    if pct < -threshold and new.high < base.low and diff > noise:
+        return 'improvement'
+    return ''
+
+
 def main():
     parser = argparse.ArgumentParser(description="Compare two Catch2 benchmark XML files.")
     parser.add_argument("baseline", help="Path to the baseline XML file")
     parser.add_argument("new", help="Path to the new XML file")
+    parser.add_argument("--thresholds", help="JSON file with allowed slowdowns in percent")
+    parser.add_argument("--sigmas", type=float, default=DEFAULT_SIGMAS,
+                        help="Standard errors a change must exceed to count (default: 3)")
+    parser.add_argument("--gate", action="store_true",
+                        help="Exit with status 1 if any benchmark regressed significantly")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="Do not fail --gate for baseline benchmarks missing from the new run")
     args = parser.parse_args()
 
     baseline_data = parse_benchmarks(args.baseline)
     new_data = parse_benchmarks(args.new)
+    default, patterns = load_thresholds(args.thresholds)
 
-    print(f"{'Benchmark Name':<50} | {'Baseline (ns)':<15} | {'New (ns)':<15} | {'Change':<10}")
-    print("-" * 100)
+    print(f"{'Benchmark Name':<50} | {'Baseline (ns)':<15} | {'New (ns)':<15} | "
+          f"{'Change':<10} | {'Limit':<7} | Verdict")
+    print("-" * 120)
 
+    regressions = []
+    missing = []
     all_names = sorted(set(baseline_data.keys()) | set(new_data.keys()))
 
     for name in all_names:
-        base_val = baseline_data.get(name)
-        new_val = new_data.get(name)
+        base = baseline_data.get(name)
+        new = new_data.get(name)
+        threshold = threshold_for(name, default, patterns)
+
+        base_str = f"{base.mean:.2f}" if base is not None else "N/A"
+        new_str = f"{new.mean:.2f}" if new is not None else "N/A"
 
-        base_str = f"{base_val:.2f}" if base_val is not None else "N/A"
-        new_str = f"{new_val:.2f}" if new_val is not None else "N/A"
-        
         change_str = "N/A"
-        if base_val is not None and new_val is not None:
-            diff = new_val - base_val
-            pct = (diff / base_val) * 100
+        verdict = ""
+        if base is not None and new is not None:
+            pct = (new.mean - base.mean) / base.mean * 100
             change_str = f"{pct:+.2f}%"
-            
-            # Color coding (optional, but nice for terminal)
-            if pct > 5: # Slower
+            verdict = classify(base, new, threshold, args.sigmas)
+
+            # Color coding only for significant changes
+            if verdict == 'regression':
                 change_str = f"\033[91m{change_str}\033[0m"
-            elif pct < -5: # Faster
+                regressions.append((name, pct, threshold))
+            elif verdict == 'improvement':
                 change_str = f"\033[92m{change_str}\033[0m"
+        elif new is None:
+            verdict = "missing"
+            missing.append(name)
+        else:
+            verdict = "new"
+
+        print(f"{name:<50} | {base_str:<15} | {new_str:<15} | {change_str:<10} | "
+              f"{threshold:>5.1f}% | {verdict}")
+
+    if regressions:
+        print(f"\n{len(regressions)} significant regression(s):")
+        for name, pct, threshold in regressions:
+            print(f"  {name}: {pct:+.2f}% (limit {threshold:.1f}%)")
+
+    if missing:
+        print(f"\n{len(missing)} benchmark(s) missing from the new run:")
+        for name in missing:
+            print(f"  {name}")
+
+    if args.gate and (regressions or (missing and not args.allow_missing)):
+        sys.exit(1)
 
-        print(f"{name:<50} | {base_str:<15} | {new_str:<15} | {change_str:<10}")
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,254 @@
+#include "benchmark_utils.hpp"
+#include "builder/ast_builder.hpp"
+#include "builder/translator.hpp"
+#include "cli/stats_report.hpp"
+#include "common/config.hpp"
+#include "common/stats.hpp"
+#include "corpus_generator.hpp"
+#include "emit/pretty_printer.hpp"
+#include "nodes/design_file.hpp"
+
+#include <algorithm>
+#include <antlr4-runtime/ANTLRInputStream.h>
+#include <antlr4-runtime/CommonTokenStream.h>
+#include <antlr4-runtime/DefaultErrorStrategy.h>
+#include <antlr4-runtime/atn/ParserATNSimulator.h>
+#include <antlr4-runtime/atn/PredictionMode.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t RUNS_PER_STAGE = 3;
+constexpr std::string_view DEFAULT_SIZES = "1000,10000,100000";
+
+using Seconds = std::chrono::duration<double>;
+
+struct NamedCorpus final
+{
+    std::string_view name;
+    utils::CorpusOptions options;
+};
+
+/// @brief The knobs varied one at a time around the baseline shape
+auto corpusShapes(const std::size_t lines) -> std::vector<NamedCorpus>
+{
+    constexpr std::size_t LINES_PER_UNIT = 50;
+    constexpr std::size_t DEEP_EXPRESSION = 12;
+    constexpr std::size_t WIDE_PORTS = 128;
+
+    return {
+        { "baseline", { .target_lines = lines } },
+        { "comments", { .target_lines = lines, .comment_density = 1.0 } },
+        { "deep-expr", { .target_lines = lines, .expression_depth = DEEP_EXPRESSION } },
+        { "wide-ports", { .target_lines = lines, .port_count = WIDE_PORTS } },
+        { "many-units",
+         { .target_lines = lines,
+            .design_units = std::max<std::size_t>(lines / LINES_PER_UNIT, 1) } },
+    };
+}
+
+/// @brief Corpus sizes in lines, from `VHDL_BENCH_CORPUS_LINES` (comma separated) if set
+auto corpusSizes() -> std::vector<std::size_t>
+{
+    const char *env = std::getenv("VHDL_BENCH_CORPUS_LINES"); // NOLINT(concurrency-mt-unsafe)
+    const std::string_view spec = (env != nullptr) ? env : DEFAULT_SIZES;
+
+    std::vector<std::size_t> sizes{};
+    for (const auto part : spec | std::views::split(',')) {
+        const std::string_view text{ part.begin(), part.end() };
+        std::size_t value{};
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec == std::errc{} && value > 0) {
+            sizes.push_back(value);
+        }
+    }
+    return sizes;
+}
+
+/// @brief Fastest of a few runs; `measure` times its own hot section and returns it
+auto bestOf(const auto &measure) -> Seconds
+{
+    Seconds best{ std::numeric_limits<double>::max() };
+    for (std::size_t run = 0; run < RUNS_PER_STAGE; ++run) {
+        best = std::min(best, measure());
+    }
+    return best;
+}
+
+auto timed(const auto &work) -> Seconds
+{
+    const auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::steady_clock::now() - start;
+}
+
+void report(const std::string_view shape,
+            const std::string_view stage,
+            const std::string_view source,
+            const std::size_t lines,
+            const Seconds elapsed)
+{
+    constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+    constexpr double MS_PER_SECOND = 1000.0;
+
+    const auto seconds = std::max(elapsed.count(), std::numeric_limits<double>::min());
+    std::cout << std::format("{:>9} {:<11} {:<16} {:>10.2f} {:>9.2f} {:>12.0f}\n",
+                             lines,
+                             shape,
+                             stage,
+                             seconds * MS_PER_SECOND,
+                             static_cast<double>(source.size()) / BYTES_PER_MB / seconds,
+                             static_cast<double>(lines) / seconds);
+}
+
+/// @brief Full LL parse with the prediction mode and error strategy of the builder's fallback
+auto parseLl(utils::ParsingContext &context) -> vhdlParser::Design_fileContext *
+{
+    auto *interpreter = context.parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+    interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
+    context.parser->setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+    return context.parser->design_file();
+}
+
+/// @brief Time every pipeline stage on its own, each on freshly built input.
+///
+/// lex, parse SLL, translate, visit and render are the stages of the ANTLR front-end, so they
+/// add up to its end-to-end row (which also reads the source and creates the parser). The
+/// generated corpus is within the fast path's subset, so the default build gets its own row.
+void runStages(const std::string_view shape, const std::string_view source)
+{
+    const auto lines = utils::countLines(source);
+    const common::Config config{};
+    const auto row = [&](const std::string_view stage, const Seconds elapsed) {
+        report(shape, stage, source, lines, elapsed);
+    };
+
+    row("lex", bestOf([&] {
+            antlr4::ANTLRInputStream input(source);
+            vhdlLexer lexer(&input);
+            antlr4::CommonTokenStream tokens(&lexer);
+            return timed([&] { tokens.fill(); });
+        }));
+
+    row("parse SLL", bestOf([&] {
+            utils::ParsingContext context(source);
+            return timed([&] { context.parse(true); });
+        }));
+
+    utils::ParsingContext parsed(source);
+    parsed.tree = parseLl(parsed);
+    row("parse LL", bestOf([&] {
+            utils::ParsingContext context(source);
+            return timed([&] { parseLl(context); });
+        }));
+
+    ast::DesignFile root{};
+    row("translate", bestOf([&] {
+            root = {};
+            return timed([&] {
+                builder::Translator translator(*parsed.tokens);
+                translator.buildDesignFile(root, parsed.tree);
+            });
+        }));
+
+    const emit::PrettyPrinter printer{};
+    auto doc = printer.visit(root);
+    row("visit", bestOf([&] { return timed([&] { doc = printer.visit(root); }); }));
+
+    row("render", bestOf([&] {
+            return timed([&] { [[maybe_unused]] const auto text = doc.render(config); });
+        }));
+
+    const auto end_to_end = [&](const builder::BuildOptions &options) {
+        return bestOf([&] {
+            return timed([&] {
+                const auto design = builder::buildFromString(source, options);
+                [[maybe_unused]] const auto text = printer.visit(design).render(config);
+            });
+        });
+    };
+    constexpr builder::BuildOptions ANTLR_ONLY{ .frontend = builder::Frontend::ANTLR };
+    constexpr builder::BuildOptions DEFAULT_BUILD{ .frontend = builder::Frontend::AUTO };
+    row("end-to-end", end_to_end(ANTLR_ONLY));
+    row("end-to-end fast", end_to_end(DEFAULT_BUILD));
+}
+
+} // namespace
+
+// Hidden: sweeping up to 1M lines takes minutes. Run with `vhdl_benchmarks "[corpus]"`,
+// optionally with VHDL_BENCH_CORPUS_LINES=1000,100000,1000000.
+TEST_CASE("Synthetic corpus throughput", "[.][corpus]")
+{
+    std::cout << std::format("{:>9} {:<11} {:<16} {:>10} {:>9} {:>12}\n",
+                             "lines",
+                             "shape",
+                             "stage",
+                             "time (ms)",
+                             "MB/s",
+                             "lines/s");
+
+    for (const auto lines : corpusSizes()) {
+        for (const auto &[name, options] : corpusShapes(lines)) {
+            runStages(name, utils::generateCorpus(options));
+        }
+    }
+}
+
+// Hidden: resident memory at each stage boundary, through the same statistics as `--stats`.
+// RSS never shrinks back below the high-water mark of earlier runs in the same process, so
+// sizes are run smallest first; run one size per process for exact peaks.
+TEST_CASE("Synthetic corpus memory", "[.][memory]")
+{
+    const common::Config config{};
+    const emit::PrettyPrinter printer{};
+
+    auto sizes = corpusSizes();
+    std::ranges::sort(sizes);
+
+    for (const auto lines : sizes) {
+        const auto source = utils::generateCorpus({ .target_lines = lines });
+
+        common::PipelineStats stats{ .file = std::format("{} lines", lines) };
+        const auto root = builder::buildFromString(
+          source, builder::BuildOptions{ .frontend = builder::Frontend::ANTLR, .stats = &stats });
+
+        const auto doc = [&] {
+            const common::PhaseTimer timer(&stats, common::Phase::DOC_BUILD);
+            return printer.visit(root);
+        }();
+        stats.sampleMemory(common::Phase::DOC_BUILD);
+        [[maybe_unused]] const auto text = doc.render(config, &stats);
+
+        std::cout << cli::formatStats(std::span{ &stats, 1 });
+    }
+}
+
+TEST_CASE("Synthetic corpus end-to-end", "[benchmark][corpus]")
+{
+    constexpr std::size_t LINES = 1'000;
+
+    for (const auto &[name, options] : corpusShapes(LINES)) {
+        const auto source = utils::generateCorpus(options);
+
+        BENCHMARK(std::format("Corpus {} 1k lines: buildFromString", name))
+        {
+            return builder::buildFromString(source);
+        };
+    }
+}
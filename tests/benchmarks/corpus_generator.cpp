@@ -0,0 +1,149 @@
+#include "corpus_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace utils {
+
+namespace {
+
+constexpr std::array<std::string_view, 4> OPERATORS{ "+", "-", "xor", "and" };
+
+/// @brief Builds one entity/architecture pair line by line
+class UnitWriter final
+{
+  public:
+    UnitWriter(std::string &out, const CorpusOptions &options, const std::size_t unit) :
+      out_(out),
+      options_(options),
+      name_(std::format("unit_{}", unit))
+    {
+    }
+
+    void write(const std::size_t line_budget)
+    {
+        const auto start = lines_;
+        writeEntity();
+        writeArchitectureHead();
+
+        // Each statement is one assignment, plus an optional comment line
+        std::size_t statement = 0;
+        while (lines_ - start + 3 < line_budget) {
+            writeStatement(statement++);
+        }
+
+        line("        end if;");
+        line("    end process;");
+        line(std::format("end architecture {};", name_));
+        line("");
+    }
+
+  private:
+    std::string &out_;
+    const CorpusOptions &options_;
+    std::string name_;
+    std::size_t lines_{ 0 };
+    double comment_debt_{ 0.0 };
+
+    void line(const std::string_view text)
+    {
+        out_.append(text);
+        out_.push_back('\n');
+        ++lines_;
+    }
+
+    [[nodiscard]]
+    auto portCount() const -> std::size_t
+    {
+        return std::max<std::size_t>(options_.port_count, 1);
+    }
+
+    void writeEntity()
+    {
+        line("library ieee;");
+        line("use ieee.std_logic_1164.all;");
+        line("");
+        line(std::format("entity {} is", name_));
+        line("    generic (WIDTH : integer := 32);");
+        line("    port (");
+        line("        clk : in std_logic;");
+        for (std::size_t i = 0; i < portCount(); ++i) {
+            const auto *mode = (i % 2 == 0) ? "in " : "out";
+            const auto *last = (i + 1 == portCount()) ? "" : ";";
+            line(std::format("        p_{} : {} std_logic_vector(WIDTH - 1 downto 0){}",
+                             i,
+                             mode,
+                             last));
+        }
+        line("    );");
+        line(std::format("end entity {};", name_));
+        line("");
+    }
+
+    void writeArchitectureHead()
+    {
+        line(std::format("architecture rtl of {} is", name_));
+        for (std::size_t i = 0; i < portCount(); ++i) {
+            line(std::format(
+              "    signal s_{} : std_logic_vector(WIDTH - 1 downto 0) := (others => '0');", i));
+        }
+        line("begin");
+        line("    process(clk)");
+        line("    begin");
+        line("        if rising_edge(clk) then");
+    }
+
+    /// @brief Left-nested operator chain over the signals, `depth` operators long
+    [[nodiscard]]
+    auto expression(const std::size_t seed) const -> std::string
+    {
+        auto expr = std::format("s_{}", seed % portCount());
+        for (std::size_t d = 0; d < options_.expression_depth; ++d) {
+            const auto op = OPERATORS.at((seed + d) % OPERATORS.size());
+            expr = std::format("({} {} s_{})", expr, op, (seed + d + 1) % portCount());
+        }
+        return expr;
+    }
+
+    void writeStatement(const std::size_t index)
+    {
+        // Spread comments evenly instead of randomly, so every run sees the same input
+        comment_debt_ += options_.comment_density;
+        if (comment_debt_ >= 1.0) {
+            comment_debt_ -= 1.0;
+            line(std::format("            -- statement {} of {}", index, name_));
+        }
+
+        line(std::format("            s_{} <= {};", index % portCount(), expression(index)));
+    }
+};
+
+} // namespace
+
+auto generateCorpus(const CorpusOptions &options) -> std::string
+{
+    const auto units = std::max<std::size_t>(options.design_units, 1);
+    const auto per_unit = options.target_lines / units;
+
+    std::string out{};
+    out.reserve(options.target_lines * 48);
+
+    for (std::size_t unit = 0; unit < units; ++unit) {
+        UnitWriter writer(out, options, unit);
+        writer.write(per_unit);
+    }
+
+    return out;
+}
+
+auto countLines(const std::string_view source) -> std::size_t
+{
+    return static_cast<std::size_t>(std::ranges::count(source, '\n'));
+}
+
+} // namespace utils
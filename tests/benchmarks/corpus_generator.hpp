@@ -0,0 +1,30 @@
+#ifndef TESTS_BENCHMARKS_CORPUS_GENERATOR_HPP
+#define TESTS_BENCHMARKS_CORPUS_GENERATOR_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace utils {
+
+/// @brief Shape of a synthetic VHDL corpus
+struct CorpusOptions final
+{
+    std::size_t target_lines{ 1'000 };  ///< Approximate number of lines to generate
+    std::size_t design_units{ 1 };      ///< Entity/architecture pairs sharing the lines
+    std::size_t port_count{ 8 };        ///< Ports per entity (and signals per architecture)
+    std::size_t expression_depth{ 3 };  ///< Operators per assigned expression
+    double comment_density{ 0.1 };      ///< Fraction of statements preceded by a comment
+};
+
+/// @brief Generate valid, deterministic VHDL of roughly `options.target_lines` lines
+[[nodiscard]]
+auto generateCorpus(const CorpusOptions &options) -> std::string;
+
+/// @brief Number of lines in `source`
+[[nodiscard]]
+auto countLines(std::string_view source) -> std::size_t;
+
+} // namespace utils
+
+#endif // TESTS_BENCHMARKS_CORPUS_GENERATOR_HPP
@@ -0,0 +1,146 @@
+#include "common/config.hpp"
+#include "emit/pretty_printer/doc.hpp"
+#include "emit/pretty_printer/doc_impl.hpp"
+#include "emit/pretty_printer/doc_utils.hpp"
+#include "emit/pretty_printer/renderer.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <vector>
+
+// Synthetic Doc trees, one shape per test case and several sizes per shape, so quadratic
+// behaviour of the layout engine shows up as a superlinear jump between neighbouring sizes.
+// Every shape is built once through the public Doc API, which is what the construct benchmark
+// times; flatten, resolveAlignment and the Renderer then run on the same tree through
+// Doc::impl().
+
+namespace {
+
+constexpr std::array<std::size_t, 3> LIST_LENGTHS{ 100, 1'000, 10'000 };
+constexpr std::array<std::size_t, 3> NESTING_DEPTHS{ 8, 24, 64 };
+constexpr std::array<std::size_t, 3> ALIGN_ROWS{ 10, 100, 1'000 };
+constexpr int ALIGN_LEVELS = 4;
+
+auto itemName(const std::size_t i) -> std::string
+{
+    return std::format("item_{}", i);
+}
+
+// ---------------------- Shapes ----------------------
+
+/// @brief `item_0, item_1, ...` separated by soft lines, in one group
+auto joinChain(const std::vector<emit::Doc> &items) -> emit::Doc
+{
+    return emit::Doc::group(emit::joinDocs(items, emit::Doc::text(",") + emit::Doc::line(), false));
+}
+
+/// @brief `(((...)))` as nested groups of brackets
+auto nestedGroups(const std::size_t depth) -> emit::Doc
+{
+    auto doc = emit::Doc::text("x");
+    for (std::size_t i = 0; i < depth; ++i) {
+        doc = emit::Doc::group(emit::Doc::bracket(emit::Doc::text("("), doc, emit::Doc::text(")")));
+    }
+    return doc;
+}
+
+/// @brief One alignment scope of `rows` lines with ALIGN_LEVELS aligned columns of varying width
+auto alignScope(const std::size_t rows) -> emit::Doc
+{
+    auto body = emit::Doc::empty();
+    for (std::size_t row = 0; row < rows; ++row) {
+        for (int level = 0; level < ALIGN_LEVELS; ++level) {
+            const auto cell = std::format("{}{}", level, std::string(row % 7, 'w'));
+            body += emit::Doc::alignText(cell, level) + emit::Doc::text(" ");
+        }
+        body += emit::Doc::hardline();
+    }
+    return emit::Doc::align(body);
+}
+
+/// @brief Run the layout phases of one shape as separate benchmarks
+void benchmarkLayout(const std::string &label, const emit::Doc &doc)
+{
+    const common::Config config{};
+    const auto &impl = doc.impl();
+
+    BENCHMARK(std::format("{}: flatten", label))
+    {
+        return emit::flatten(impl);
+    };
+
+    BENCHMARK(std::format("{}: resolveAlignment", label))
+    {
+        return emit::resolveAlignment(impl);
+    };
+
+    BENCHMARK(std::format("{}: render", label))
+    {
+        emit::Renderer renderer(config);
+        return renderer.render(impl);
+    };
+}
+
+} // namespace
+
+TEST_CASE("Doc join chains", "[benchmark][doc]")
+{
+    for (const auto length : LIST_LENGTHS) {
+        std::vector<emit::Doc> items{};
+        items.reserve(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            items.push_back(emit::Doc::text(itemName(i)));
+        }
+
+        BENCHMARK(std::format("joinDocs x{}: construct", length))
+        {
+            return joinChain(items);
+        };
+
+        benchmarkLayout(std::format("joinDocs x{}", length), joinChain(items));
+    }
+}
+
+TEST_CASE("Doc nested groups", "[benchmark][doc]")
+{
+    for (const auto depth : NESTING_DEPTHS) {
+        BENCHMARK(std::format("group/bracket depth {}: construct", depth))
+        {
+            return nestedGroups(depth);
+        };
+
+        benchmarkLayout(std::format("group/bracket depth {}", depth), nestedGroups(depth));
+    }
+}
+
+TEST_CASE("Doc alignment scopes", "[benchmark][doc]")
+{
+    for (const auto rows : ALIGN_ROWS) {
+        BENCHMARK(std::format("align {} rows x{} levels: construct", rows, ALIGN_LEVELS))
+        {
+            return alignScope(rows);
+        };
+
+        benchmarkLayout(std::format("align {} rows x{} levels", rows, ALIGN_LEVELS),
+                        alignScope(rows));
+    }
+}
+
+TEST_CASE("Doc text merges", "[benchmark][doc]")
+{
+    for (const auto length : LIST_LENGTHS) {
+        // Adjacent texts are merged by makeConcat, copying the accumulated string each time
+        BENCHMARK(std::format("Text merge x{}: construct", length))
+        {
+            auto doc = emit::Doc::empty();
+            for (std::size_t i = 0; i < length; ++i) {
+                doc += emit::Doc::text("token ");
+            }
+            return doc;
+        };
+    }
+}
@@ -0,0 +1,49 @@
+#include "builder/ast_builder.hpp"
+#include "common/config.hpp"
+#include "emit/pretty_printer.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Inputs that `vhdl_perf_cliff` found to be disproportionately slow or allocation-heavy, kept
+// so a fix stays fixed. One end-to-end benchmark per saved file.
+
+TEST_CASE("Saved performance cliffs", "[benchmark][regression]")
+{
+    const std::filesystem::path dir{ REGRESSION_DIR };
+
+    std::vector<std::filesystem::path> files{};
+    for (const auto &entry : std::filesystem::directory_iterator{ dir }) {
+        if (entry.is_regular_file() && entry.path().extension() == ".vhd") {
+            files.push_back(entry.path());
+        }
+    }
+    std::ranges::sort(files);
+
+    if (files.empty()) {
+        SKIP("No saved inputs in " << dir.string());
+    }
+
+    const common::Config config{};
+    const emit::PrettyPrinter printer{};
+    const builder::BuildOptions options{ .resilient = true };
+
+    for (const auto &path : files) {
+        std::ifstream file{ path, std::ios::binary };
+        const std::string source{ std::istreambuf_iterator<char>{ file },
+                                  std::istreambuf_iterator<char>{} };
+
+        BENCHMARK(std::format("Regression {}: end-to-end", path.stem().string()))
+        {
+            const auto root = builder::buildFromString(source, options);
+            return printer.visit(root).render(config);
+        };
+    }
+}
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Measure the startup latency of the vhdl_formatter binary on small inputs.
+
+The in-process benchmarks never pay for exec, dynamic loading, static
+initialisation, argument parsing, configuration loading or the one-time ANTLR
+ATN deserialisation, yet for per-file invocations from make these dominate.
+
+For every input the binary is launched:
+
+  * cold: after evicting the binary, its shared libraries and the input from
+    the page cache (posix_fadvise DONTNEED; pages still mapped by another
+    process stay resident, so this is a best effort without root),
+  * warm: repeatedly once caches are hot.
+
+A second warm series runs with --stats-json to break the time down by phase.
+Time not covered by any phase is reported as "outside main": exec, loading,
+static initialisation and process teardown.
+"""
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_RUNS = 50
+DEFAULT_COLD_RUNS = 5
+WARMUP_RUNS = 3
+
+SMALL_VHDL = """\
+entity startup is
+    port (
+        clk : in std_logic;
+        q   : out std_logic
+    );
+end entity startup;
+
+architecture rtl of startup is
+begin
+    q <= clk;
+end architecture rtl;
+"""
+
+
+def shared_libraries(binary):
+    """Shared libraries the binary loads, from ldd; empty when unavailable."""
+    try:
+        output = subprocess.run(["ldd", binary], capture_output=True, text=True,
+                                check=False).stdout
+    except OSError:
+        return []
+    libraries = []
+    for line in output.splitlines():
+        parts = line.split("=>")
+        path = (parts[1] if len(parts) > 1 else parts[0]).split("(")[0].strip()
+        if path.startswith("/"):
+            libraries.append(path)
+    return libraries
+
+
+def evict(paths):
+    for path in paths:
+        try:
+            fd = os.open(path, os.O_RDONLY)
+        except OSError:
+            continue
+        try:
+            os.fsync(fd)
+            os.posix_fadvise(fd, 0, 0, os.POSIX_FADV_DONTNEED)
+        except OSError:
+            pass
+        finally:
+            os.close(fd)
+
+
+def launch(binary, input_path, extra_args):
+    """Run the binary once; returns (wall seconds, stderr)."""
+    start = time.perf_counter()
+    result = subprocess.run([binary, *extra_args, input_path], stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE, text=True, check=False)
+    wall = time.perf_counter() - start
+    if result.returncode != 0:
+        print(f"{binary} failed on {input_path}:\n{result.stderr}", file=sys.stderr)
+        sys.exit(2)
+    return wall, result.stderr
+
+
+def phase_times(stats_json):
+    """Top-level phase times in seconds from --stats-json; sub-phases are nested in others."""
+    phases = json.loads(stats_json)["total"]["phases"]
+    return {name: entry["time_ms"] / 1e3 for name, entry in phases.items()
+            if name != "align"}
+
+
+def ms(seconds):
+    return f"{seconds * 1e3:9.3f}"
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def benchmark(binary, input_path, runs, cold_runs):
+    size = os.path.getsize(input_path)
+    print(f"{os.path.basename(input_path)} ({size} B)")
+    print(f"  {'':<14}{'median':>9} {'p90':>9} {'min':>9}  (ms)")
+
+    cached = [binary, input_path, *shared_libraries(binary)]
+    cold = []
+    for _ in range(cold_runs):
+        evict(cached)
+        cold.append(launch(binary, input_path, [])[0])
+
+    for _ in range(WARMUP_RUNS):
+        launch(binary, input_path, [])
+    warm = [launch(binary, input_path, [])[0] for _ in range(runs)]
+
+    for label, samples in (("cold", cold), ("warm", warm)):
+        if samples:
+            print(f"  {label:<14}{ms(statistics.median(samples))} "
+                  f"{ms(percentile(samples, 0.9))} {ms(min(samples))}")
+
+    walls = []
+    per_phase = {}
+    for _ in range(runs):
+        wall, stderr = launch(binary, input_path, ["--stats-json"])
+        walls.append(wall)
+        for name, seconds in phase_times(stderr).items():
+            per_phase.setdefault(name, []).append(seconds)
+
+    medians = {name: statistics.median(times) for name, times in per_phase.items()}
+    outside = statistics.median(walls) - sum(medians.values())
+
+    print(f"  warm breakdown, median of {runs} runs with --stats-json:")
+    print(f"    {'outside main':<14}{ms(outside)}  exec, loading, static init, exit")
+    for name, seconds in medians.items():
+        print(f"    {name.replace('_', ' '):<14}{ms(seconds)}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("binary", help="Path to vhdl_formatter")
+    parser.add_argument("inputs", nargs="*",
+                        help="VHDL files to format (default: a built-in small entity)")
+    parser.add_argument("--runs", type=int, default=DEFAULT_RUNS,
+                        help=f"Warm runs per input (default {DEFAULT_RUNS})")
+    parser.add_argument("--cold-runs", type=int, default=DEFAULT_COLD_RUNS,
+                        help=f"Cold runs per input (default {DEFAULT_COLD_RUNS})")
+    args = parser.parse_args()
+
+    if not os.access(args.binary, os.X_OK):
+        print(f"Missing binary {args.binary}; build vhdl_formatter first")
+        sys.exit(2)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        inputs = args.inputs
+        if not inputs:
+            small = os.path.join(tmp, "small.vhd")
+            with open(small, "w", encoding="utf-8") as file:
+                file.write(SMALL_VHDL)
+            inputs = [small]
+
+        for input_path in inputs:
+            benchmark(args.binary, input_path, args.runs, args.cold_runs)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,135 @@
+#include "builder/ast_builder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// @brief Fixed set of threads that run one job per round.
+///
+/// The threads live across rounds, so thread-local state (such as a per-thread DFA) is
+/// warmed up once instead of being rebuilt for every measured iteration.
+class WorkerPool final
+{
+  public:
+    WorkerPool(const std::size_t count, std::function<void()> job) :
+      job_(std::move(job)),
+      start_(static_cast<std::ptrdiff_t>(count + 1)),
+      done_(static_cast<std::ptrdiff_t>(count + 1))
+    {
+        workers_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            workers_.emplace_back([this] { work(); });
+        }
+    }
+
+    ~WorkerPool()
+    {
+        stop_ = true;
+        start_.arrive_and_wait();
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    auto operator=(const WorkerPool &) -> WorkerPool & = delete;
+    WorkerPool(WorkerPool &&) = delete;
+    auto operator=(WorkerPool &&) -> WorkerPool & = delete;
+
+    /// @brief Run the job once on every thread and wait for all of them
+    void run()
+    {
+        start_.arrive_and_wait();
+        done_.arrive_and_wait();
+    }
+
+  private:
+    std::function<void()> job_;
+    std::barrier<> start_;
+    std::barrier<> done_;
+    std::atomic<bool> stop_{ false };
+    std::vector<std::jthread> workers_; // Last, so threads join before the barriers go
+
+    void work()
+    {
+        while (true) {
+            start_.arrive_and_wait();
+            if (stop_) {
+                return;
+            }
+            job_();
+            done_.arrive_and_wait();
+        }
+    }
+};
+
+auto loadCorpus() -> std::vector<std::string>
+{
+    std::vector<std::string> corpus{};
+    const auto dir = std::filesystem::path{ TEST_DATA_DIR } / "vhdl";
+    for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+        std::ifstream file(entry.path());
+        corpus.emplace_back(std::istreambuf_iterator<char>{ file },
+                            std::istreambuf_iterator<char>{});
+    }
+    return corpus;
+}
+
+auto threadCounts() -> std::vector<std::size_t>
+{
+    const std::size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+
+    std::vector<std::size_t> counts{};
+    for (std::size_t n = 1; n < max_threads; n *= 2) {
+        counts.push_back(n);
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+} // namespace
+
+TEST_CASE("Parser thread scaling", "[benchmark][threads]")
+{
+    // Every thread parses the whole corpus per round; with perfect scaling the time per
+    // round stays flat as threads are added. The ANTLR front-end is forced because the
+    // hand-written parser never touches the DFA.
+    const auto corpus = loadCorpus();
+    REQUIRE_FALSE(corpus.empty());
+
+    const std::pair<builder::DfaCache, const char *> caches[] = {
+        { builder::DfaCache::SHARED, "shared DFA" },
+        { builder::DfaCache::PER_THREAD, "per-thread DFA" },
+    };
+
+    for (const auto &[cache, cache_name] : caches) {
+        const builder::BuildOptions options{ .frontend = builder::Frontend::ANTLR,
+                                             .dfa_cache = cache };
+
+        for (const auto threads : threadCounts()) {
+            WorkerPool pool(threads, [&corpus, &options] {
+                thread_local builder::Session session{};
+                for (const auto &source : corpus) {
+                    [[maybe_unused]] const auto root = session.buildFromString(source, options);
+                }
+            });
+            pool.run(); // Warm up every thread's caches
+
+            BENCHMARK(std::format("Corpus x{} threads ({})", threads, cache_name))
+            {
+                pool.run();
+            };
+        }
+    }
+}
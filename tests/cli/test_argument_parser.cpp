@@ -49,7 +49,8 @@ TEST_CASE("ArgumentParser with valid arguments including all options", "[argumen
     const std::string file_path_str = temp_input.string();
     const std::string config_path_str = temp_config.string();
     const std::vector<std::string_view> args
-      = { "vhdl-fmt", "--write", "--check", "--location", config_path_str, file_path_str };
+      = { "vhdl-fmt",   "--write",       "--check",    "--resilient",
+          "--location", config_path_str, file_path_str };
 
     const auto c_args = createArgs(args);
     const std::span<const char *const> args_span{ c_args };
@@ -61,6 +62,7 @@ TEST_CASE("ArgumentParser with valid arguments including all options", "[argumen
     REQUIRE(parser.getConfigPath().value() == std::filesystem::canonical(temp_config));
     REQUIRE(parser.isFlagSet(cli::ArgumentFlag::WRITE));
     REQUIRE(parser.isFlagSet(cli::ArgumentFlag::CHECK));
+    REQUIRE(parser.isFlagSet(cli::ArgumentFlag::RESILIENT));
 
     // Cleanup
     std::filesystem::remove(temp_input);
@@ -90,6 +92,7 @@ TEST_CASE("ArgumentParser with valid arguments minimal options", "[argument_pars
     REQUIRE_FALSE(parser.getConfigPath().has_value());
     REQUIRE_FALSE(parser.isFlagSet(cli::ArgumentFlag::WRITE));
     REQUIRE_FALSE(parser.isFlagSet(cli::ArgumentFlag::CHECK));
+    REQUIRE_FALSE(parser.isFlagSet(cli::ArgumentFlag::RESILIENT));
 
     // Cleanup
     std::filesystem::remove(temp_input);
@@ -213,3 +216,57 @@ TEST_CASE("ArgumentParser with flags set correctly", "[argument_parser]")
     // Cleanup
     std::filesystem::remove(temp_input);
 }
+
+TEST_CASE("ArgumentParser with stats flags", "[argument_parser]")
+{
+    const auto [flags, stats_set, json_set]
+      = GENERATE(table<std::vector<std::string_view>, bool, bool>({
+        { {},                 false, false },
+        { { "--stats" },      true,  false },
+        { { "-s" },           true,  false },
+        { { "--stats-json" }, false, true  }
+    }));
+
+    const std::filesystem::path temp_input
+      = std::filesystem::temp_directory_path() / "test_input.vhd";
+
+    {
+        std::ofstream temp_input_file{ temp_input };
+        temp_input_file << "entity test is end entity;";
+    }
+
+    const std::string file_path_str = temp_input.string();
+    std::vector<std::string_view> args = { "vhdl-fmt", file_path_str };
+    args.insert(args.cend(), flags.cbegin(), flags.cend());
+
+    const auto c_args = createArgs(args);
+    const cli::ArgumentParser parser{ std::span<const char *const>{ c_args } };
+
+    REQUIRE(parser.isFlagSet(cli::ArgumentFlag::STATS) == stats_set);
+    REQUIRE(parser.isFlagSet(cli::ArgumentFlag::STATS_JSON) == json_set);
+
+    std::filesystem::remove(temp_input);
+}
+
+TEST_CASE("ArgumentParser with trace output path", "[argument_parser]")
+{
+    const std::filesystem::path temp_input
+      = std::filesystem::temp_directory_path() / "test_input.vhd";
+
+    {
+        std::ofstream temp_input_file{ temp_input };
+        temp_input_file << "entity test is end entity;";
+    }
+
+    const std::string file_path_str = temp_input.string();
+
+    const auto without_c_args = createArgs({ "vhdl-fmt", file_path_str });
+    const cli::ArgumentParser without{ std::span<const char *const>{ without_c_args } };
+    REQUIRE_FALSE(without.getTracePath().has_value());
+
+    const auto with_c_args = createArgs({ "vhdl-fmt", file_path_str, "--trace", "out.json" });
+    const cli::ArgumentParser with{ std::span<const char *const>{ with_c_args } };
+    REQUIRE(with.getTracePath() == std::filesystem::path{ "out.json" });
+
+    std::filesystem::remove(temp_input);
+}
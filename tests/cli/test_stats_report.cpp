@@ -0,0 +1,97 @@
+#include "cli/stats_report.hpp"
+#include "common/stats.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+auto makeStats(const std::string &file) -> common::PipelineStats
+{
+    common::PipelineStats stats{
+        .file = file, .fast_path = true, .tokens = 10, .allocations_counted = true
+    };
+    stats.phase(common::Phase::PARSE) = common::PhaseStats{
+        .time = std::chrono::milliseconds{ 2 },
+        .allocations = 3,
+        .bytes = 64,
+    };
+    return stats;
+}
+
+} // namespace
+
+TEST_CASE("PhaseTimer without stats records nothing", "[stats]")
+{
+    const common::PhaseTimer timer(nullptr, common::Phase::LEX);
+    SUCCEED();
+}
+
+TEST_CASE("PhaseTimer adds its scope to one phase", "[stats]")
+{
+    common::PipelineStats stats{};
+    {
+        const common::PhaseTimer timer(&stats, common::Phase::LEX);
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+    }
+
+    REQUIRE(stats.phase(common::Phase::LEX).time >= std::chrono::milliseconds{ 1 });
+    REQUIRE(stats.phase(common::Phase::PARSE).time == std::chrono::nanoseconds{ 0 });
+}
+
+TEST_CASE("Text statistics list every phase and add a total for several files", "[stats]")
+{
+    const std::vector files{ makeStats("a.vhd"), makeStats("b.vhd") };
+
+    const auto single = cli::formatStats(std::span{ files }.first(1));
+    REQUIRE(single.contains("a.vhd"));
+    REQUIRE(single.contains("  align"));
+    REQUIRE(single.contains("setup"));
+    REQUIRE(single.contains("front-end: fast"));
+    REQUIRE_FALSE(single.contains("total"));
+
+    const auto both = cli::formatStats(files);
+    REQUIRE(both.contains("b.vhd"));
+    REQUIRE(both.contains("\ntotal\n"));
+    REQUIRE(both.contains("tokens: 20"));
+}
+
+TEST_CASE("JSON statistics hold the files and their total", "[stats]")
+{
+    const std::vector files{ makeStats(R"(dir\"quoted".vhd)") };
+
+    const auto json = cli::formatStatsJson(files);
+
+    REQUIRE(json.starts_with(R"({"files":[{"file":"dir\\\"quoted\".vhd")"));
+    REQUIRE(json.contains(R"("parse":{"time_ms":2.000,"allocations":3,"bytes":64,"rss_bytes":0})"));
+    REQUIRE(json.contains(R"("align":)"));
+    REQUIRE(json.contains(R"("total":{"file":"total","front_end":"fast")"));
+}
+
+TEST_CASE("Memory samples keep the largest resident set size of a phase", "[stats]")
+{
+    common::PipelineStats stats{};
+    stats.sampleMemory(common::Phase::LEX);
+
+#ifdef __linux__
+    REQUIRE(stats.phase(common::Phase::LEX).rss > 0);
+    REQUIRE(stats.peak_rss >= stats.phase(common::Phase::LEX).rss);
+#endif
+    REQUIRE(stats.phase(common::Phase::PARSE).rss == 0);
+}
+
+TEST_CASE("Allocations are n/a without the counting operator new", "[stats]")
+{
+    auto stats = makeStats("a.vhd");
+    stats.allocations_counted = false;
+    const std::vector files{ stats };
+
+    REQUIRE_FALSE(common::allocationsCounted());
+    REQUIRE(common::PipelineStats{}.allocations_counted == common::allocationsCounted());
+    REQUIRE(cli::formatStats(files).contains("n/a"));
+    REQUIRE(cli::formatStatsJson(files).contains(R"("allocations":null,"bytes":null)"));
+}
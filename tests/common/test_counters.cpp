@@ -0,0 +1,36 @@
+#include "common/counters.hpp"
+#include "common/counters_dump.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST_CASE("Counter dump lists every counter", "[counters]")
+{
+    std::ostringstream out{};
+    common::dumpCounters(out);
+    const auto dump = out.str();
+
+    for (std::size_t i = 0; i < common::COUNTER_COUNT; ++i) {
+        const auto name = common::counterName(static_cast<common::Counter>(i));
+        INFO(name);
+        REQUIRE(dump.find(name) != std::string::npos);
+    }
+}
+
+TEST_CASE("Counts of exited threads reach the totals only when enabled", "[counters]")
+{
+    const auto total = [] {
+        return common::detail::counterTotals()
+          .at(static_cast<std::size_t>(common::Counter::FOLD_NODES))
+          .load();
+    };
+    const auto before = total();
+
+    std::thread worker{ [] { common::count(common::Counter::FOLD_NODES, 3); } };
+    worker.join();
+
+    REQUIRE(total() - before == (common::COUNTERS_ENABLED ? 3U : 0U));
+}
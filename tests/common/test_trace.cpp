@@ -0,0 +1,24 @@
+#include "common/trace.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+
+TEST_CASE("Tracer writes spans of each thread to their own lane", "[trace]")
+{
+    auto &tracer = common::Tracer::instance();
+    tracer.enable();
+
+    {
+        const common::TraceSpan span("outer");
+        std::thread worker{ [] { const common::TraceSpan inner("on worker"); } };
+        worker.join();
+    }
+
+    const auto json = tracer.toJson();
+
+    REQUIRE(json.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+    REQUIRE(json.contains(R"("name":"outer","ph":"X")"));
+    REQUIRE(json.contains(R"("name":"on worker","ph":"X")"));
+    REQUIRE(json.contains(R"("args":{"name":"worker 1"})"));
+}
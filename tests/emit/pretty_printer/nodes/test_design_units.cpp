@@ -148,3 +148,15 @@ TEST_CASE("Simple Architecture", "[pretty_printer][design_units]")
 
     REQUIRE(result == EXPECTED);
 }
+
+TEST_CASE("Raw unit drops carriage returns of CRLF lines", "[pretty_printer][design_units]")
+{
+    const ast::RawUnit raw{ .text = "entity b is\r\n  port (x : in );\r\nend b;" };
+
+    const std::string result = emit::test::render(raw);
+    constexpr std::string_view EXPECTED = "entity b is\n"
+                                          "  port (x : in );\n"
+                                          "end b;";
+
+    REQUIRE(result == EXPECTED);
+}
@@ -0,0 +1,22 @@
+#include "pipeline.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+// libFuzzer entry point. Any exception other than a reported syntax error escapes and is
+// reported as a crash, as are sanitizer findings and timeouts (`-timeout=`).
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t *data, const std::size_t size) -> int
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const std::string_view source{ reinterpret_cast<const char *>(data), size };
+
+    try {
+        static_cast<void>(fuzz::formatSource(source));
+    } catch (const std::runtime_error &) {
+        // Errors the builder reports on purpose (e.g. unreadable input) are not findings
+    }
+
+    return 0;
+}
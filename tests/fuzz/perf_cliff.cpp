@@ -0,0 +1,375 @@
+// Looks for performance cliffs: inputs whose cost grows much faster than their size.
+//
+// Every input, generated or read from disk, is formatted end to end and its time and allocated
+// bytes are divided by its size after subtracting the cost of a minimal design file. Inputs whose
+// cost per byte exceeds `--factor` times the median are reported and saved to `--save-dir`, where
+// the "Saved performance cliffs" benchmark picks them up. Inputs that throw are saved as well.
+//
+// `--dry-run` saves nothing and only fails on inputs that throw: timing on a shared machine is
+// too noisy to gate on, so outliers are printed for information.
+//
+// Usage: vhdl_perf_cliff [--factor K] [--save-dir DIR] [--dry-run] [file-or-directory...]
+
+#include "common/stats.hpp"
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+constexpr double DEFAULT_FACTOR = 10.0;
+constexpr std::size_t RUNS_PER_INPUT = 3;
+constexpr std::size_t FIRST_SIZE = 16;
+constexpr std::size_t SIZE_STEP = 4;
+
+struct Input final
+{
+    std::string name;
+    std::string source;
+};
+
+/// @brief Best-of-N wall time and the allocations of one run
+struct Cost final
+{
+    std::chrono::nanoseconds time{};
+    std::uint64_t allocated_bytes{};
+};
+
+struct Result final
+{
+    std::string name;
+    std::size_t size{};
+    Cost cost;
+    double ns_per_byte{};
+    double allocated_per_byte{};
+    std::optional<std::string> error;
+};
+
+struct Options final
+{
+    double factor{ DEFAULT_FACTOR };
+    std::filesystem::path save_dir{ REGRESSION_DIR };
+    bool dry_run{ false };
+    std::vector<std::filesystem::path> paths;
+};
+
+// ---------------------- Generated inputs ----------------------
+
+auto designFile(const std::string_view declarations, const std::string_view statements)
+  -> std::string
+{
+    return std::format("entity cliff is\n"
+                       "end entity cliff;\n"
+                       "\n"
+                       "architecture rtl of cliff is\n"
+                       "    signal a, s : integer;\n"
+                       "{}"
+                       "begin\n"
+                       "{}"
+                       "end architecture rtl;\n",
+                       declarations,
+                       statements);
+}
+
+/// @brief `constant c : integer := ((((a))));`
+auto deepParentheses(const std::size_t depth) -> std::string
+{
+    return designFile(std::format("    constant c : integer := {}1{};\n",
+                                  std::string(depth, '('),
+                                  std::string(depth, ')')),
+                      "");
+}
+
+/// @brief `s <= a + a + ... + a;`
+auto operatorChain(const std::size_t length) -> std::string
+{
+    std::string expr{ "a" };
+    for (std::size_t i = 1; i < length; ++i) {
+        expr += " + a";
+    }
+    return designFile("", std::format("    s <= {};\n", expr));
+}
+
+/// @brief Thousands of comment lines bound to one statement
+auto commentsOnOneNode(const std::size_t count) -> std::string
+{
+    std::string comments{};
+    for (std::size_t i = 0; i < count; ++i) {
+        comments += std::format("    -- comment {}\n", i);
+    }
+    return designFile("", comments + "    s <= a;\n");
+}
+
+/// @brief `if a = 0 then if a = 0 then ... end if; end if;` inside one process
+auto nestedIfs(const std::size_t depth) -> std::string
+{
+    std::string body{};
+    for (std::size_t i = 0; i < depth; ++i) {
+        body += "if a = 0 then\n";
+    }
+    body += "s <= a;\n";
+    for (std::size_t i = 0; i < depth; ++i) {
+        body += "end if;\n";
+    }
+    return designFile("", std::format("    process (a) is\n    begin\n{}    end process;\n", body));
+}
+
+/// @brief `s <= (0 => a, 1 => a, ...);`
+auto wideAggregate(const std::size_t width) -> std::string
+{
+    std::string choices{};
+    for (std::size_t i = 0; i < width; ++i) {
+        choices += std::format("{}{} => a", i == 0 ? "" : ", ", i);
+    }
+    return designFile("", std::format("    s <= ({});\n", choices));
+}
+
+struct Family final
+{
+    std::string_view name;
+    std::size_t max_size; ///< Nesting families stay below what the recursive parser can stack
+    std::function<std::string(std::size_t)> generate;
+};
+
+auto generatedInputs() -> std::vector<Input>
+{
+    const std::vector<Family> families{
+        { "deep-parens", 1'024, deepParentheses },
+        { "operator-chain", 16'384, operatorChain },
+        { "comments-on-node", 16'384, commentsOnOneNode },
+        { "nested-if", 256, nestedIfs },
+        { "wide-aggregate", 16'384, wideAggregate },
+    };
+
+    std::vector<Input> inputs{};
+    for (const auto &family : families) {
+        for (std::size_t size = FIRST_SIZE; size <= family.max_size; size *= SIZE_STEP) {
+            inputs.push_back({ std::format("{}-{}", family.name, size), family.generate(size) });
+        }
+    }
+    return inputs;
+}
+
+// ---------------------- Inputs from disk ----------------------
+
+auto readFile(const std::filesystem::path &path) -> std::string
+{
+    std::ifstream file{ path, std::ios::binary };
+    return { std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+}
+
+auto isVhdlFile(const std::filesystem::path &path) -> bool
+{
+    return path.extension() == ".vhd" || path.extension() == ".vhdl";
+}
+
+auto fileInputs(const std::span<const std::filesystem::path> paths) -> std::vector<Input>
+{
+    std::vector<Input> inputs{};
+    for (const auto &path : paths) {
+        if (std::filesystem::is_directory(path)) {
+            for (const auto &entry : std::filesystem::recursive_directory_iterator{ path }) {
+                if (entry.is_regular_file() && isVhdlFile(entry.path())) {
+                    inputs.push_back({ entry.path().stem().string(), readFile(entry.path()) });
+                }
+            }
+        } else {
+            inputs.push_back({ path.stem().string(), readFile(path) });
+        }
+    }
+    return inputs;
+}
+
+// ---------------------- Measurement ----------------------
+
+auto measure(const std::string_view source) -> Cost
+{
+    Cost cost{ .time = std::chrono::nanoseconds::max() };
+    for (std::size_t run = 0; run < RUNS_PER_INPUT; ++run) {
+        const auto start_bytes = common::threadAllocations().bytes;
+        const auto start = std::chrono::steady_clock::now();
+        static_cast<void>(fuzz::formatSource(source));
+        cost.time = std::min<std::chrono::nanoseconds>(cost.time,
+                                                       std::chrono::steady_clock::now() - start);
+        cost.allocated_bytes = common::threadAllocations().bytes - start_bytes;
+    }
+    return cost;
+}
+
+/// @brief Cost of `input` per byte beyond the minimal design file
+auto evaluate(const Input &input, const Cost &fixed, const std::size_t fixed_size) -> Result
+{
+    Result result{ .name = input.name, .size = input.source.size(), .cost = {}, .error = {} };
+
+    // Print before running, so the culprit is on screen if the process dies
+    std::cout << std::format("{:<28} {:>9} B ", result.name, result.size) << std::flush;
+
+    try {
+        result.cost = measure(input.source);
+    } catch (const std::exception &e) {
+        result.error = e.what();
+        std::cout << "error: " << e.what() << '\n';
+        return result;
+    }
+
+    const auto extra_bytes =
+      static_cast<double>(std::max(result.size, fixed_size + 1) - fixed_size);
+    const auto extra_time = std::max(result.cost.time - fixed.time, std::chrono::nanoseconds{ 0 });
+    const auto extra_alloc = result.cost.allocated_bytes
+                             - std::min(result.cost.allocated_bytes, fixed.allocated_bytes);
+
+    result.ns_per_byte = static_cast<double>(extra_time.count()) / extra_bytes;
+    result.allocated_per_byte = static_cast<double>(extra_alloc) / extra_bytes;
+
+    std::cout << std::format("{:>10.1f} us {:>8.1f} ns/B {:>8.1f} alloc B/B\n",
+                             static_cast<double>(result.cost.time.count()) / 1e3,
+                             result.ns_per_byte,
+                             result.allocated_per_byte);
+    return result;
+}
+
+auto median(std::vector<double> values) -> double
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    std::ranges::nth_element(values, middle);
+    return *middle;
+}
+
+// ---------------------- Command line ----------------------
+
+auto parseOptions(const std::span<char *> args) -> Options
+{
+    Options options{};
+    for (std::size_t i = 1; i < args.size(); ++i) {
+        const std::string_view arg{ args[i] };
+        const auto has_value = i + 1 < args.size();
+
+        if (arg == "--factor" && has_value) {
+            const std::string_view value{ args[++i] };
+            const auto [_, ec] =
+              std::from_chars(value.data(), value.data() + value.size(), options.factor);
+            if (ec != std::errc{} || options.factor <= 0.0) {
+                throw std::runtime_error(std::format("Invalid --factor '{}'", value));
+            }
+        } else if (arg == "--save-dir" && has_value) {
+            options.save_dir = args[++i];
+        } else if (arg == "--dry-run") {
+            options.dry_run = true;
+        } else if (arg.starts_with("--")) {
+            throw std::runtime_error(std::format("Unknown option '{}'", arg));
+        } else {
+            options.paths.emplace_back(arg);
+        }
+    }
+    return options;
+}
+
+void save(const Input &input, const Options &options)
+{
+    if (options.dry_run) {
+        return;
+    }
+    std::filesystem::create_directories(options.save_dir);
+    const auto path = options.save_dir / std::format("{}.vhd", input.name);
+    std::ofstream{ path, std::ios::binary } << input.source;
+    std::cout << "  saved " << path.string() << '\n';
+}
+
+} // namespace
+
+auto main(int argc, char *argv[]) -> int
+{
+    Options options{};
+    try {
+        options = parseOptions(std::span<char *>{ argv, static_cast<std::size_t>(argc) });
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << '\n'
+                  << "Usage: vhdl_perf_cliff [--factor K] [--save-dir DIR] [--dry-run] "
+                     "[file-or-directory...]\n";
+        return EXIT_FAILURE;
+    }
+
+    auto inputs = generatedInputs();
+    std::ranges::move(fileInputs(options.paths), std::back_inserter(inputs));
+
+    const auto fixed_source = designFile("", "");
+    static_cast<void>(measure(fixed_source)); // Warm up the parser's shared DFA cache
+    const auto fixed = measure(fixed_source);
+
+    std::vector<Result> results{};
+    results.reserve(inputs.size());
+    for (const auto &input : inputs) {
+        results.push_back(evaluate(input, fixed, fixed_source.size()));
+    }
+
+    std::vector<double> times{};
+    std::vector<double> allocs{};
+    for (const auto &result : results) {
+        if (!result.error) {
+            times.push_back(result.ns_per_byte);
+            allocs.push_back(result.allocated_per_byte);
+        }
+    }
+    const auto time_limit = options.factor * median(times);
+    const auto alloc_limit = options.factor * median(allocs);
+
+    std::cout << std::format("\nmedian {:.1f} ns/B, {:.1f} alloc B/B; flagging above {}x\n",
+                             median(times),
+                             median(allocs),
+                             options.factor);
+
+    std::size_t flagged = 0;
+    std::size_t errors = 0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+        std::string reason{};
+        if (result.error) {
+            reason = std::format("threw: {}", *result.error);
+            ++errors;
+        } else if (result.ns_per_byte > time_limit) {
+            reason = std::format("{:.1f} ns/B", result.ns_per_byte);
+        } else if (alloc_limit > 0.0 && result.allocated_per_byte > alloc_limit) {
+            reason = std::format("{:.1f} alloc B/B", result.allocated_per_byte);
+        } else {
+            continue;
+        }
+
+        ++flagged;
+        std::cout << std::format("CLIFF {} ({} B): {}\n", result.name, result.size, reason);
+        save(inputs[i], options);
+    }
+
+    if (flagged == 0) {
+        std::cout << "No performance cliffs found\n";
+        return EXIT_SUCCESS;
+    }
+    if (options.dry_run) {
+        std::cout << std::format("{} outlier(s) reported for information, {} input(s) threw\n",
+                                 flagged - errors,
+                                 errors);
+        return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,34 @@
+#ifndef TESTS_FUZZ_PIPELINE_HPP
+#define TESTS_FUZZ_PIPELINE_HPP
+
+#include "ast/symbol.hpp"
+#include "builder/ast_builder.hpp"
+#include "common/config.hpp"
+#include "emit/pretty_printer.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace fuzz {
+
+/// @brief Run the whole formatter on `source` like the CLI does.
+///
+/// Resilient mode keeps broken units verbatim, so arbitrary input goes through every stage
+/// instead of stopping at the first syntax error.
+inline auto formatSource(const std::string_view source) -> std::string
+{
+    auto formatted = [&] {
+        const auto root
+          = builder::buildFromString(source, builder::BuildOptions{ .resilient = true });
+        const emit::PrettyPrinter printer{};
+        return printer.visit(root).render(common::Config{});
+    }();
+
+    // The AST is gone, so its identifiers need not outlive it across millions of inputs
+    ast::SymbolTable::local().clear();
+    return formatted;
+}
+
+} // namespace fuzz
+
+#endif // TESTS_FUZZ_PIPELINE_HPP
@@ -0,0 +1,39 @@
+// Runs the fuzz target on the files given on the command line, so crashes found by libFuzzer
+// can be reproduced and debugged in a regular build.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <span>
+#include <string>
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) -> int;
+
+auto main(int argc, char *argv[]) -> int
+{
+    const std::span<char *> args{ argv, static_cast<std::size_t>(argc) };
+    if (args.size() < 2) {
+        std::cerr << "Usage: " << args[0] << " <input>...\n";
+        return EXIT_FAILURE;
+    }
+
+    for (const auto *path : args.subspan(1)) {
+        std::ifstream file{ std::filesystem::path{ path }, std::ios::binary };
+        if (!file) {
+            std::cerr << "Cannot open " << path << '\n';
+            return EXIT_FAILURE;
+        }
+        const std::string data{ std::istreambuf_iterator<char>{ file },
+                                std::istreambuf_iterator<char>{} };
+
+        std::cout << "Running " << path << " (" << data.size() << " bytes)\n";
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t *>(data.data()), data.size());
+    }
+
+    return EXIT_SUCCESS;
+}